@@ -0,0 +1,3 @@
+#pragma once
+
+#include "../include/Profiling.hpp" // IWYU pragma: export
@@ -0,0 +1,236 @@
+#pragma once
+// IWYU pragma: private; include JobSystem.hpp
+
+#include "PlatformSemantics.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Engine::Base
+{
+	class JobSystem;
+
+	namespace Detail
+	{
+		/**
+		 * Shared state of a single scheduled job
+		 */
+		struct JobState
+		{
+			std::function<void()> function;
+
+			// Dependencies that have not finished yet, plus one while the job is being scheduled
+			std::atomic<uint32_t> unfinished = 1;
+
+			std::atomic<bool>  done = false;
+			std::exception_ptr exception;
+
+			// Jobs waiting for this one to finish, guarded by lock
+			std::mutex							   lock;
+			std::vector<std::shared_ptr<JobState>> continuations;
+
+			// Run on the thread that owns the JobSystem instead of a worker
+			bool main_thread = false;
+		};
+	} // namespace Detail
+
+	/**
+	 * Reference to a scheduled job, cheap to copy
+	 */
+	class JobHandle final
+	{
+	public:
+		JobHandle() = default;
+
+		/**
+		 * Whether the handle refers to a job at all
+		 */
+		[[nodiscard]] bool isValid() const noexcept
+		{
+			return state != nullptr;
+		}
+
+		/**
+		 * Whether the job has finished running (invalid handles count as finished)
+		 */
+		[[nodiscard]] bool isDone() const noexcept
+		{
+			return state == nullptr || state->done.load(std::memory_order_acquire);
+		}
+
+	private:
+		friend class JobSystem;
+
+		explicit JobHandle(std::shared_ptr<Detail::JobState> with_state) : state(std::move(with_state))
+		{}
+
+		std::shared_ptr<Detail::JobState> state;
+	};
+
+	/**
+	 * Work-stealing thread pool
+	 *
+	 * Every worker owns a queue, it runs its own jobs newest first and steals the oldest jobs
+	 * of other workers when it runs out. Jobs can depend on other jobs, in which case
+	 * they are only queued once all of their dependencies finished.
+	 *
+	 * Jobs that have to stay on the thread owning the JobSystem (Vulkan, Lua)
+	 * are held until that thread calls @ref runMainThreadJobs().
+	 */
+	class JobSystem final
+	{
+	public:
+		using job_t		 = std::function<void()>;
+		using range_job_t = std::function<void(size_t begin, size_t end)>;
+
+		struct Stats
+		{
+			uint64_t executed = 0;
+			uint64_t stolen	  = 0;
+		};
+
+		/**
+		 * @param worker_count    Number of worker threads, 0 to use one less than the number of cores
+		 * @param on_worker_start Called on every worker thread when it starts, with the worker index
+		 */
+		explicit JobSystem(
+			size_t						worker_count	= 0,
+			std::function<void(size_t)> on_worker_start = {}
+		);
+		~JobSystem();
+
+		JobSystem(const JobSystem&)			   = delete;
+		JobSystem(JobSystem&&)				   = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+		JobSystem& operator=(JobSystem&&)	   = delete;
+
+		/**
+		 * Schedule a job on a worker thread
+		 *
+		 * @param job          Callable to run
+		 * @param dependencies Jobs that have to finish before this one starts
+		 *
+		 * @return Handle to the scheduled job
+		 */
+		JobHandle schedule(job_t job, std::span<const JobHandle> dependencies = {});
+
+		/**
+		 * Schedule a job that runs once @p after finished
+		 */
+		JobHandle then(const JobHandle& after, job_t job)
+		{
+			return schedule(std::move(job), {&after, 1});
+		}
+
+		/**
+		 * Schedule a job that runs on the owning thread during @ref runMainThreadJobs()
+		 *
+		 * @copydetails schedule()
+		 */
+		JobHandle scheduleMainThread(job_t job, std::span<const JobHandle> dependencies = {});
+
+		/**
+		 * Split the range [0, @p count) into chunks of at most @p grain_size and run them in parallel
+		 *
+		 * @param count        Size of the range
+		 * @param grain_size   Maximum number of elements per job
+		 * @param body         Callable run with the bounds of each chunk
+		 * @param dependencies Jobs that have to finish before any chunk starts
+		 *
+		 * @return Handle that finishes once every chunk finished
+		 */
+		JobHandle parallelFor(
+			size_t						count,
+			size_t						grain_size,
+			range_job_t					body,
+			std::span<const JobHandle> dependencies = {}
+		);
+
+		/**
+		 * Wait for a job to finish, running other jobs in the meantime
+		 *
+		 * @throws Rethrows any exception thrown by the job
+		 */
+		void wait(const JobHandle& handle);
+
+		/**
+		 * Run all jobs queued for the owning thread
+		 *
+		 * @note Has to be called from the thread that constructed the JobSystem
+		 *
+		 * @return Number of jobs that were run
+		 */
+		size_t runMainThreadJobs();
+
+		[[nodiscard]] size_t getWorkerCount() const noexcept
+		{
+			return workers.size();
+		}
+
+		[[nodiscard]] bool isMainThread() const noexcept
+		{
+			return std::this_thread::get_id() == main_thread_id;
+		}
+
+		[[nodiscard]] Stats getStats() const noexcept
+		{
+			return {
+				.executed = executed_count.load(std::memory_order_relaxed),
+				.stolen	  = stolen_count.load(std::memory_order_relaxed)
+			};
+		}
+
+	private:
+		using job_ptr_t = std::shared_ptr<Detail::JobState>;
+
+		struct Worker
+		{
+			std::mutex			  lock;
+			std::deque<job_ptr_t> queue;
+
+			std::thread thread;
+		};
+
+		std::vector<std::unique_ptr<Worker>> workers;
+
+		std::mutex			  main_thread_lock;
+		std::deque<job_ptr_t> main_thread_queue;
+		std::thread::id		  main_thread_id;
+
+		// Jobs that are queued on workers but not yet picked up
+		std::atomic<size_t>		queued_count = 0;
+		std::mutex				sleep_lock;
+		std::condition_variable sleep_condition;
+		bool					stopping = false;
+
+		// Used to spread jobs pushed from threads that aren't workers
+		std::atomic<size_t> next_worker = 0;
+
+		std::atomic<uint64_t> executed_count = 0;
+		std::atomic<uint64_t> stolen_count	 = 0;
+
+		void workerMain(size_t index, std::function<void(size_t)> on_worker_start);
+
+		JobHandle submit(job_ptr_t job, std::span<const JobHandle> dependencies);
+		void	  enqueue(job_ptr_t job);
+		void	  execute(const job_ptr_t& job);
+
+		/**
+		 * Try to take a job, from the own queue first if called from a worker
+		 *
+		 * @return Job or nullptr if every queue is empty
+		 */
+		job_ptr_t tryTake();
+	};
+} // namespace Engine::Base
@@ -0,0 +1,138 @@
+#pragma once
+// IWYU pragma: private; include Profiling.hpp
+
+#include "PlatformSemantics.hpp"
+#include "cmake_cfg.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace Engine::Base::Profiling
+{
+	using clock_t = std::chrono::steady_clock;
+
+	/**
+	 * A single finished zone as recorded in the ring buffer of the thread that ran it
+	 */
+	struct ZoneRecord
+	{
+		const char*		   name;
+		const char*		   category;
+		clock_t::time_point start;
+		clock_t::time_point end;
+		uint32_t		   depth;
+	};
+
+	/**
+	 * Scoped instrumentation zone, records the time between construction and destruction.
+	 * Zones nest per-thread, the depth is recorded along with the timestamps.
+	 *
+	 * @note Prefer the @ref PROFILE_ZONE macros over using this directly,
+	 *       they compile out if profiling is disabled.
+	 *
+	 * @note The first zone of a thread allocates its ring buffer, later zones
+	 *       are recorded without locks or allocations
+	 */
+	class Zone final
+	{
+	public:
+		/**
+		 * @param with_name     Name of the zone, has to outlive the profiler (i.e. a literal),
+		 *                      use @ref internName() for runtime strings
+		 * @param with_category Category of the zone
+		 */
+		Zone(const char* with_name, const char* with_category = "engine");
+		~Zone() noexcept;
+
+		Zone(const Zone&)			 = delete;
+		Zone(Zone&&)				 = delete;
+		Zone& operator=(const Zone&) = delete;
+		Zone& operator=(Zone&&)		 = delete;
+
+	private:
+		const char*			name;
+		const char*			category;
+		clock_t::time_point start;
+	};
+
+	/**
+	 * Get a pointer to a copy of @p name that stays valid until the program exits
+	 *
+	 * @note Takes a lock, avoid in very hot paths.
+	 *       Returns an empty name if profiling is disabled.
+	 */
+	[[nodiscard]] const char* internName(std::string_view name);
+
+	/**
+	 * Set the name the calling thread is shown with in traces
+	 *
+	 * @note Allocates the ring buffer of the thread if it has none yet,
+	 *       does nothing if profiling is disabled
+	 */
+	void setThreadName(std::string_view name);
+
+	/**
+	 * Mark the start of a new frame, used to select a window of frames when writing a trace
+	 */
+	void markFrame() noexcept;
+
+	/**
+	 * Write recorded zones of all threads as a Chrome trace (also readable by Perfetto)
+	 *
+	 * @param path        Path of the JSON file to write
+	 * @param frame_count Number of most recent frames to include, 0 to write everything recorded
+	 *
+	 * @return Number of zones written
+	 */
+	size_t writeChromeTrace(const std::filesystem::path& path, size_t frame_count = 0);
+
+	/**
+	 * Get the peak resident memory of the process
+	 *
+	 * @return Size in bytes, 0 if unsupported on this platform
+	 */
+	[[nodiscard]] size_t getPeakResidentMemory() noexcept;
+
+	// NOLINTBEGIN(*unused-macros)
+#define PROFILING_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define PROFILING_CONCAT(lhs, rhs)		PROFILING_CONCAT_IMPL(lhs, rhs)
+
+#if defined(CMEP_ENABLE_PROFILING)
+/**
+ * Record a zone lasting until the end of the enclosing scope
+ */
+#	define PROFILE_ZONE(name)                                                                      \
+		const ::Engine::Base::Profiling::Zone PROFILING_CONCAT(profile_zone_, __LINE__)(name)
+
+/**
+ * @copydoc PROFILE_ZONE
+ * @param category Category shown in the trace
+ */
+#	define PROFILE_ZONE_CATEGORY(name, category)                                                   \
+		const ::Engine::Base::Profiling::Zone PROFILING_CONCAT(profile_zone_, __LINE__)(           \
+			name,                                                                                  \
+			category                                                                               \
+		)
+
+/**
+ * Record a zone whose name is only known at runtime (interns the name)
+ */
+#	define PROFILE_ZONE_DYNAMIC(name, category)                                                    \
+		PROFILE_ZONE_CATEGORY(::Engine::Base::Profiling::internName(name), category)
+
+/**
+ * Mark the start of a new frame
+ */
+#	define PROFILE_FRAME_MARK() ::Engine::Base::Profiling::markFrame()
+#else
+#	define PROFILE_ZONE(name)
+#	define PROFILE_ZONE_CATEGORY(name, category)
+#	define PROFILE_ZONE_DYNAMIC(name, category)
+#	define PROFILE_FRAME_MARK()
+#endif
+	// NOLINTEND(*unused-macros)
+} // namespace Engine::Base::Profiling
@@ -0,0 +1,322 @@
+#include "JobSystem.hpp"
+
+#include "Exception.hpp"
+#include "Profiling.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <format>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Engine::Base
+{
+#pragma region Internal static
+
+	namespace
+	{
+		// Identifies the worker running on the current thread
+		thread_local const JobSystem* current_system = nullptr;
+		thread_local size_t			  current_worker = 0;
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+	JobSystem::JobSystem(size_t worker_count, std::function<void(size_t)> on_worker_start)
+		: main_thread_id(std::this_thread::get_id())
+	{
+		if (worker_count == 0)
+		{
+			// Leave one core for the thread owning the system
+			worker_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+		}
+
+		// All queues have to exist before any worker starts stealing
+		workers.reserve(worker_count);
+		for (size_t idx = 0; idx < worker_count; idx++)
+		{
+			workers.push_back(std::make_unique<Worker>());
+		}
+
+		for (size_t idx = 0; idx < worker_count; idx++)
+		{
+			workers[idx]->thread = std::thread(&JobSystem::workerMain, this, idx, on_worker_start);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard guard(sleep_lock);
+			stopping = true;
+		}
+		sleep_condition.notify_all();
+
+		for (auto& worker : workers) { worker->thread.join(); }
+	}
+
+	JobHandle JobSystem::schedule(job_t job, std::span<const JobHandle> dependencies)
+	{
+		auto state		= std::make_shared<Detail::JobState>();
+		state->function = std::move(job);
+
+		return submit(std::move(state), dependencies);
+	}
+
+	JobHandle JobSystem::scheduleMainThread(job_t job, std::span<const JobHandle> dependencies)
+	{
+		auto state		   = std::make_shared<Detail::JobState>();
+		state->function	   = std::move(job);
+		state->main_thread = true;
+
+		return submit(std::move(state), dependencies);
+	}
+
+	JobHandle JobSystem::parallelFor(
+		size_t					   count,
+		size_t					   grain_size,
+		range_job_t				   body,
+		std::span<const JobHandle> dependencies
+	)
+	{
+		grain_size = std::max(grain_size, size_t{1});
+
+		// Shared between chunks instead of copying the callable into each of them
+		auto shared_body = std::make_shared<range_job_t>(std::move(body));
+
+		std::vector<JobHandle> chunks;
+		chunks.reserve((count + grain_size - 1) / grain_size);
+
+		for (size_t begin = 0; begin < count; begin += grain_size)
+		{
+			const size_t end = std::min(begin + grain_size, count);
+
+			chunks.push_back(schedule(
+				[shared_body, begin, end]() { (*shared_body)(begin, end); },
+				dependencies
+			));
+		}
+
+		// Joins the chunks and forwards the first exception any of them threw
+		return schedule(
+			[chunks]() {
+				for (const auto& chunk : chunks)
+				{
+					if (chunk.state->exception) { std::rethrow_exception(chunk.state->exception); }
+				}
+			},
+			chunks.empty() ? dependencies : std::span<const JobHandle>(chunks)
+		);
+	}
+
+	void JobSystem::wait(const JobHandle& handle)
+	{
+		if (!handle.isValid()) { return; }
+
+		PROFILE_ZONE_CATEGORY("JobSystem::wait", "job");
+
+		while (!handle.isDone())
+		{
+			// The awaited job may be (or depend on) a job that has to run here
+			if (isMainThread() && runMainThreadJobs() > 0) { continue; }
+
+			if (auto job = tryTake())
+			{
+				execute(job);
+				continue;
+			}
+
+			std::this_thread::yield();
+		}
+
+		if (handle.state->exception) { std::rethrow_exception(handle.state->exception); }
+	}
+
+	size_t JobSystem::runMainThreadJobs()
+	{
+		EXCEPTION_ASSERT(isMainThread(), "Main thread jobs can only be run on the main thread!");
+
+		std::deque<job_ptr_t> jobs;
+		{
+			std::lock_guard guard(main_thread_lock);
+			jobs.swap(main_thread_queue);
+		}
+
+		for (const auto& job : jobs) { execute(job); }
+
+		return jobs.size();
+	}
+
+#pragma endregion
+
+#pragma region Private
+
+	void JobSystem::workerMain(size_t index, std::function<void(size_t)> on_worker_start)
+	{
+		current_system = this;
+		current_worker = index;
+
+		Profiling::setThreadName(std::format("worker {}", index));
+
+		if (on_worker_start) { on_worker_start(index); }
+
+		while (true)
+		{
+			if (auto job = tryTake())
+			{
+				execute(job);
+				continue;
+			}
+
+			std::unique_lock guard(sleep_lock);
+			sleep_condition.wait(guard, [&] {
+				return stopping || queued_count.load(std::memory_order_acquire) > 0;
+			});
+
+			// Queued jobs are still finished when stopping
+			if (stopping && queued_count.load(std::memory_order_acquire) == 0) { return; }
+		}
+	}
+
+	JobHandle JobSystem::submit(job_ptr_t job, std::span<const JobHandle> dependencies)
+	{
+		for (const auto& dependency : dependencies)
+		{
+			if (!dependency.isValid()) { continue; }
+
+			auto& dependency_state = *dependency.state;
+
+			std::lock_guard guard(dependency_state.lock);
+			if (!dependency_state.done.load(std::memory_order_acquire))
+			{
+				job->unfinished.fetch_add(1, std::memory_order_relaxed);
+				dependency_state.continuations.push_back(job);
+			}
+		}
+
+		// Drop the reference held while scheduling, queue the job if nothing else holds it back
+		if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) { enqueue(job); }
+
+		return JobHandle(std::move(job));
+	}
+
+	void JobSystem::enqueue(job_ptr_t job)
+	{
+		if (job->main_thread)
+		{
+			std::lock_guard guard(main_thread_lock);
+			main_thread_queue.push_back(std::move(job));
+			return;
+		}
+
+		// Workers push to their own queue, other threads spread jobs over all workers
+		const size_t target = current_system == this
+								  ? current_worker
+								  : next_worker.fetch_add(1, std::memory_order_relaxed) %
+										workers.size();
+
+		{
+			std::lock_guard guard(workers[target]->lock);
+			workers[target]->queue.push_back(std::move(job));
+			queued_count.fetch_add(1, std::memory_order_release);
+		}
+
+		// Taking the lock orders this against a worker that is about to sleep
+		{
+			std::lock_guard guard(sleep_lock);
+		}
+		sleep_condition.notify_one();
+	}
+
+	void JobSystem::execute(const job_ptr_t& job)
+	{
+		{
+			PROFILE_ZONE_CATEGORY("Job", "job");
+
+			try
+			{
+				job->function();
+			}
+			catch (...)
+			{
+				job->exception = std::current_exception();
+			}
+		}
+
+		// Release whatever the job captured
+		job->function = nullptr;
+
+		executed_count.fetch_add(1, std::memory_order_relaxed);
+
+		std::vector<job_ptr_t> continuations;
+		{
+			std::lock_guard guard(job->lock);
+			job->done.store(true, std::memory_order_release);
+			continuations.swap(job->continuations);
+		}
+
+		for (auto& continuation : continuations)
+		{
+			if (continuation->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				enqueue(std::move(continuation));
+			}
+		}
+	}
+
+	JobSystem::job_ptr_t JobSystem::tryTake()
+	{
+		const size_t worker_count = workers.size();
+		const bool	 is_worker	  = current_system == this;
+
+		// Own queue is used as a stack, recently pushed jobs are likely still in cache
+		if (is_worker)
+		{
+			auto&			 own = *workers[current_worker];
+			std::lock_guard guard(own.lock);
+
+			if (!own.queue.empty())
+			{
+				auto job = std::move(own.queue.back());
+				own.queue.pop_back();
+				queued_count.fetch_sub(1, std::memory_order_relaxed);
+				return job;
+			}
+		}
+
+		// Steal the oldest job of another worker
+		const size_t first = is_worker ? current_worker + 1 : 0;
+		for (size_t offset = 0; offset < worker_count; offset++)
+		{
+			const size_t victim_index = (first + offset) % worker_count;
+			if (is_worker && victim_index == current_worker) { continue; }
+
+			auto&			 victim = *workers[victim_index];
+			std::lock_guard guard(victim.lock);
+
+			if (!victim.queue.empty())
+			{
+				auto job = std::move(victim.queue.front());
+				victim.queue.pop_front();
+				queued_count.fetch_sub(1, std::memory_order_relaxed);
+
+				if (is_worker) { stolen_count.fetch_add(1, std::memory_order_relaxed); }
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+#pragma endregion
+} // namespace Engine::Base
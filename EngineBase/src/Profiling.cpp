@@ -0,0 +1,364 @@
+#include "Profiling.hpp"
+
+#include "Exception.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#if defined(SEMANTICS_MSVC)
+#	define WIN32_LEAN_AND_MEAN
+#	include <windows.h>
+// windows.h has to be included first
+#	include <psapi.h>
+#elif defined(SEMANTICS_UNIXLIKE) && !defined(_WIN32)
+#	include <sys/resource.h>
+#endif
+
+namespace Engine::Base::Profiling
+{
+#pragma region Internal static
+
+	namespace
+	{
+		// Number of zones kept per thread, oldest zones get overwritten
+		constexpr size_t zone_ring_capacity	 = size_t{1} << 16;
+		// Number of frame marks kept
+		constexpr size_t frame_ring_capacity = 4096;
+
+		/**
+		 * Ring of records written only by its owning thread
+		 *
+		 * The writer publishes a record by advancing the write index, readers copy records
+		 * and then drop those the writer may have overwritten meanwhile.
+		 */
+		template <typename record_t, size_t capacity>
+		class RecordRing final
+		{
+		public:
+			void push(const record_t& record) noexcept
+			{
+				const uint64_t index = write_index.load(std::memory_order_relaxed);
+
+				records[index % capacity] = record;
+				write_index.store(index + 1, std::memory_order_release);
+			}
+
+			/**
+			 * Copy the records currently in the ring, oldest first
+			 */
+			[[nodiscard]] std::vector<record_t> read() const
+			{
+				const uint64_t end	 = write_index.load(std::memory_order_acquire);
+				const uint64_t begin = end > capacity ? end - capacity : 0;
+
+				std::vector<record_t> result;
+				result.reserve(static_cast<size_t>(end - begin));
+				for (uint64_t index = begin; index < end; index++)
+				{
+					result.push_back(records[index % capacity]);
+				}
+
+				// Records overwritten while copying may be torn,
+				// including the one the writer may be in the middle of
+				std::atomic_thread_fence(std::memory_order_acquire);
+				const uint64_t written	   = write_index.load(std::memory_order_relaxed);
+				const uint64_t valid_begin = written >= capacity ? written - capacity + 1 : 0;
+
+				if (valid_begin > begin)
+				{
+					result.erase(
+						result.begin(),
+						result.begin() +
+							static_cast<ptrdiff_t>(std::min(valid_begin - begin, end - begin))
+					);
+				}
+
+				return result;
+			}
+
+		private:
+			std::array<record_t, capacity> records{};
+			std::atomic<uint64_t>		   write_index = 0;
+		};
+
+		struct ThreadBuffer
+		{
+			// Allocated once when the thread registers
+			RecordRing<ZoneRecord, zone_ring_capacity> zones;
+
+			// Only ever touched by the owning thread
+			uint32_t depth = 0;
+
+			uint32_t	thread_id = 0;
+			// Guarded by the registry lock
+			std::string thread_name;
+		};
+
+		struct Registry
+		{
+			std::mutex lock;
+
+			std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+			// Node-based, so pointers to the strings stay valid on rehash
+			std::unordered_set<std::string> interned_names;
+
+			uint32_t next_thread_id = 1;
+
+			const clock_t::time_point epoch = clock_t::now();
+		};
+
+		Registry& getRegistry()
+		{
+			static Registry registry;
+			return registry;
+		}
+
+#if defined(CMEP_ENABLE_PROFILING)
+		// Frames are only marked by the engine thread
+		RecordRing<clock_t::time_point, frame_ring_capacity> frame_ring;
+
+		ThreadBuffer& getThreadBuffer()
+		{
+			// The registry holds a reference too, so that zones of exited threads can be written
+			thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+				auto new_buffer = std::make_shared<ThreadBuffer>();
+
+				auto&			 registry = getRegistry();
+				std::lock_guard guard(registry.lock);
+
+				new_buffer->thread_id	= registry.next_thread_id++;
+				new_buffer->thread_name = std::format("thread {}", new_buffer->thread_id);
+				registry.buffers.push_back(new_buffer);
+
+				return new_buffer;
+			}();
+
+			return *buffer;
+		}
+#endif
+
+		void appendEscaped(std::string& output, std::string_view input)
+		{
+			for (const char character : input)
+			{
+				switch (character)
+				{
+					case '"':  output.append("\\\""); break;
+					case '\\': output.append("\\\\"); break;
+					case '\n': output.append("\\n"); break;
+					case '\t': output.append("\\t"); break;
+					default:
+					{
+						if (static_cast<unsigned char>(character) < 0x20) { output.push_back(' '); }
+						else { output.push_back(character); }
+						break;
+					}
+				}
+			}
+		}
+
+		double toMicroseconds(clock_t::time_point epoch, clock_t::time_point time)
+		{
+			return std::chrono::duration<double, std::micro>(time - epoch).count();
+		}
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+#if defined(CMEP_ENABLE_PROFILING)
+	Zone::Zone(const char* with_name, const char* with_category)
+		: name(with_name), category(with_category)
+	{
+		// Registers the thread on its first zone
+		getThreadBuffer().depth++;
+
+		start = clock_t::now();
+	}
+
+	Zone::~Zone() noexcept
+	{
+		const auto end = clock_t::now();
+
+		auto& buffer = getThreadBuffer();
+		buffer.depth--;
+
+		buffer.zones.push(
+			{.name = name, .category = category, .start = start, .end = end, .depth = buffer.depth}
+		);
+	}
+
+	const char* internName(std::string_view name)
+	{
+		auto&			 registry = getRegistry();
+		std::lock_guard guard(registry.lock);
+
+		const auto [iter, inserted] = registry.interned_names.emplace(name);
+
+		return iter->c_str();
+	}
+
+	void setThreadName(std::string_view name)
+	{
+		auto& buffer = getThreadBuffer();
+
+		auto&			 registry = getRegistry();
+		std::lock_guard guard(registry.lock);
+		buffer.thread_name = name;
+	}
+
+	void markFrame() noexcept
+	{
+		frame_ring.push(clock_t::now());
+	}
+#else
+	// Nothing is recorded, threads never allocate a buffer
+
+	Zone::Zone(const char* with_name, const char* with_category)
+		: name(with_name), category(with_category)
+	{}
+
+	Zone::~Zone() noexcept = default;
+
+	const char* internName(std::string_view /* name */)
+	{
+		return "";
+	}
+
+	void setThreadName(std::string_view /* name */) {}
+
+	void markFrame() noexcept {}
+#endif
+
+	size_t writeChromeTrace(const std::filesystem::path& path, size_t frame_count)
+	{
+		auto& registry = getRegistry();
+
+		std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+		std::vector<std::string>				   thread_names;
+		{
+			std::lock_guard guard(registry.lock);
+
+			buffers = registry.buffers;
+			for (const auto& buffer : buffers) { thread_names.push_back(buffer->thread_name); }
+		}
+
+#if defined(CMEP_ENABLE_PROFILING)
+		std::vector<clock_t::time_point> frames = frame_ring.read();
+#else
+		std::vector<clock_t::time_point> frames;
+#endif
+
+		// Only include zones that started after the first frame of the window
+		clock_t::time_point window_start = registry.epoch;
+		if (frame_count != 0 && frames.size() > frame_count)
+		{
+			frames.erase(frames.begin(), frames.end() - static_cast<ptrdiff_t>(frame_count));
+		}
+		if (frame_count != 0 && !frames.empty()) { window_start = frames.front(); }
+
+		std::string output = "{\"traceEvents\":[\n";
+		size_t		zone_count = 0;
+
+		auto append_event_separator = [&, first = true]() mutable {
+			if (!first) { output.append(",\n"); }
+			first = false;
+		};
+
+		for (size_t buffer_idx = 0; buffer_idx < buffers.size(); buffer_idx++)
+		{
+			const auto& buffer = buffers[buffer_idx];
+
+			append_event_separator();
+			output.append(std::format(
+				R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":")",
+				buffer->thread_id
+			));
+			appendEscaped(output, thread_names[buffer_idx]);
+			output.append("\"}}");
+
+			// Threads keep recording while the trace is written
+			for (const auto& record : buffer->zones.read())
+			{
+				if (record.start < window_start) { continue; }
+
+				append_event_separator();
+				output.append("{\"name\":\"");
+				appendEscaped(output, record.name);
+				output.append("\",\"cat\":\"");
+				appendEscaped(output, record.category);
+				output.append(std::format(
+					R"(","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{},"args":{{"depth":{}}}}})",
+					toMicroseconds(registry.epoch, record.start),
+					std::chrono::duration<double, std::micro>(record.end - record.start).count(),
+					buffer->thread_id,
+					record.depth
+				));
+
+				zone_count++;
+			}
+		}
+
+		// Frame boundaries as global instant events
+		for (const auto& frame : frames)
+		{
+			append_event_separator();
+			output.append(std::format(
+				R"({{"name":"Frame","ph":"i","s":"g","ts":{:.3f},"pid":1,"tid":0}})",
+				toMicroseconds(registry.epoch, frame)
+			));
+		}
+
+		output.append("\n],\"displayTimeUnit\":\"ms\"}\n");
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			throw ENGINE_EXCEPTION(std::format("Could not open trace file '{}'", path.string()));
+		}
+
+		file.write(output.data(), static_cast<std::streamsize>(output.size()));
+
+		return zone_count;
+	}
+
+	size_t getPeakResidentMemory() noexcept
+	{
+#if defined(SEMANTICS_MSVC)
+		PROCESS_MEMORY_COUNTERS counters{};
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0) { return 0; }
+
+		return counters.PeakWorkingSetSize;
+#elif defined(SEMANTICS_UNIXLIKE) && !defined(_WIN32)
+		rusage usage{};
+		if (getrusage(RUSAGE_SELF, &usage) != 0) { return 0; }
+
+#	if defined(__APPLE__)
+		// Reported in bytes on macOS
+		return static_cast<size_t>(usage.ru_maxrss);
+#	else
+		// Reported in kilobytes everywhere else
+		return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#	endif
+#else
+		return 0;
+#endif
+	}
+
+#pragma endregion
+} // namespace Engine::Base::Profiling
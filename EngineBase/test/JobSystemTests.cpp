@@ -0,0 +1,203 @@
+#include "JobSystem.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using Engine::Base::JobHandle;
+	using Engine::Base::JobSystem;
+
+	class TestFailure final : public std::runtime_error
+	{
+	public:
+		using std::runtime_error::runtime_error;
+	};
+
+#define TEST_ASSERT(condition)                                                                     \
+	if (!(condition))                                                                              \
+	{                                                                                              \
+		throw TestFailure(std::string(#condition) + " (line " + std::to_string(__LINE__) + ")");    \
+	}
+
+	void testDependencies()
+	{
+		JobSystem jobs(4);
+
+		std::atomic<int> first_done = 0;
+		std::atomic<int> order_ok	= 0;
+
+		std::vector<JobHandle> firsts;
+		for (int idx = 0; idx < 16; idx++)
+		{
+			firsts.push_back(jobs.schedule([&]() {
+				std::this_thread::yield();
+				first_done.fetch_add(1);
+			}));
+		}
+
+		// Has to see every dependency finished
+		const JobHandle joined = jobs.schedule([&]() { order_ok = first_done.load(); }, firsts);
+
+		jobs.wait(joined);
+
+		TEST_ASSERT(joined.isDone());
+		TEST_ASSERT(order_ok.load() == 16);
+	}
+
+	void testThen()
+	{
+		JobSystem jobs(2);
+
+		std::vector<int> sequence;
+
+		// Each link only starts once the previous one finished, so no lock is needed
+		JobHandle last = jobs.schedule([&]() { sequence.push_back(0); });
+		for (int idx = 1; idx < 32; idx++)
+		{
+			last = jobs.then(last, [&sequence, idx]() { sequence.push_back(idx); });
+		}
+
+		jobs.wait(last);
+
+		std::vector<int> expected(32);
+		std::iota(expected.begin(), expected.end(), 0);
+
+		TEST_ASSERT(sequence == expected);
+	}
+
+	void testParallelFor()
+	{
+		JobSystem jobs(4);
+
+		constexpr size_t count = 10007;
+
+		std::vector<std::atomic<int>> visits(count);
+
+		jobs.wait(jobs.parallelFor(count, 64, [&](size_t begin, size_t end) {
+			for (size_t idx = begin; idx < end; idx++) { visits[idx].fetch_add(1); }
+		}));
+
+		for (const auto& visit : visits) { TEST_ASSERT(visit.load() == 1); }
+
+		// Empty ranges still produce a handle that finishes
+		bool ran = false;
+		jobs.wait(jobs.parallelFor(0, 64, [&](size_t, size_t) { ran = true; }));
+		TEST_ASSERT(!ran);
+	}
+
+	void testExceptions()
+	{
+		JobSystem jobs(2);
+
+		const JobHandle failing = jobs.schedule([]() { throw std::runtime_error("job failed"); });
+
+		bool caught = false;
+		try
+		{
+			jobs.wait(failing);
+		}
+		catch (const std::runtime_error&)
+		{
+			caught = true;
+		}
+		TEST_ASSERT(caught);
+
+		const JobHandle failing_range = jobs.parallelFor(100, 10, [](size_t begin, size_t) {
+			if (begin == 50) { throw std::runtime_error("chunk failed"); }
+		});
+
+		caught = false;
+		try
+		{
+			jobs.wait(failing_range);
+		}
+		catch (const std::runtime_error&)
+		{
+			caught = true;
+		}
+		TEST_ASSERT(caught);
+	}
+
+	void testMainThreadJobs()
+	{
+		JobSystem jobs(2);
+
+		const auto main_id = std::this_thread::get_id();
+
+		std::atomic<bool> worker_done	 = false;
+		std::thread::id	  main_job_id	 = {};
+		bool			  saw_dependency = false;
+
+		const JobHandle worker_job = jobs.schedule([&]() { worker_done = true; });
+
+		auto main_function = [&]() {
+			main_job_id	   = std::this_thread::get_id();
+			saw_dependency = worker_done.load();
+		};
+		const JobHandle main_job = jobs.scheduleMainThread(main_function, {&worker_job, 1});
+
+		// Runs the main thread job once its dependency finished
+		jobs.wait(main_job);
+
+		TEST_ASSERT(main_job_id == main_id);
+		TEST_ASSERT(saw_dependency);
+
+		// Main thread jobs scheduled by workers are held until the main thread runs them
+		std::atomic<bool> ran_on_main = false;
+		JobHandle		  nested_job;
+
+		jobs.wait(jobs.schedule([&]() {
+			nested_job = jobs.scheduleMainThread([&]() {
+				ran_on_main = std::this_thread::get_id() == main_id;
+			});
+		}));
+
+		jobs.wait(nested_job);
+		TEST_ASSERT(ran_on_main.load());
+	}
+
+	struct TestCase
+	{
+		const char*			  name;
+		std::function<void()> function;
+	};
+} // namespace
+
+int main()
+{
+	const std::vector<TestCase> tests = {
+		{"dependencies", testDependencies},
+		{"then", testThen},
+		{"parallelFor", testParallelFor},
+		{"exceptions", testExceptions},
+		{"mainThreadJobs", testMainThreadJobs},
+	};
+
+	int failed = 0;
+	for (const auto& test : tests)
+	{
+		try
+		{
+			test.function();
+			std::printf("[ OK ] %s\n", test.name);
+		}
+		catch (const std::exception& e)
+		{
+			std::printf("[FAIL] %s: %s\n", test.name, e.what());
+			failed++;
+		}
+	}
+
+	std::printf("%zu tests, %d failed\n", tests.size(), failed);
+
+	return failed == 0 ? 0 : 1;
+}
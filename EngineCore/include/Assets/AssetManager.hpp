@@ -99,6 +99,20 @@ namespace Engine
 			map.emplace(name, asset);
 		}
 
+		/**
+		 * Call @p callback for every asset of a type
+		 *
+		 * @tparam asset_t Type of asset
+		 *
+		 * @param callback Callable taking the name and the asset entry
+		 */
+		template <typename asset_t, typename callback_t>
+		void forEachAsset(callback_t&& callback)
+			requires(IsAsset<asset_t>)
+		{
+			for (const auto& [name, asset] : getAssetMap<asset_t>()) { callback(name, asset); }
+		}
+
 		/**
 		 * Removes all assets from this repository
 		 */
@@ -2,6 +2,7 @@
 
 #include "Asset.hpp"
 #include "InternalEngineObject.hpp"
+#include "MemoryUsage.hpp"
 
 #include <memory>
 #include <optional>
@@ -58,6 +59,11 @@ namespace Engine::Rendering
 		[[nodiscard]] std::optional<const FontChar*> getChar(char character) const;
 		[[nodiscard]] std::optional<std::string> getFontInfoParameter(const std::string& name) const;
 
+		/**
+		 * Get the memory used by the glyph table and all page textures
+		 */
+		[[nodiscard]] MemoryUsage getMemoryUsage() const;
+
 	private:
 		std::unique_ptr<FontData> data;
 	};
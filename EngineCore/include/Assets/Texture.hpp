@@ -5,6 +5,7 @@
 
 #include "Asset.hpp"
 #include "InternalEngineObject.hpp"
+#include "MemoryUsage.hpp"
 
 #include <cstdint>
 #include <memory>
@@ -48,6 +49,11 @@ namespace Engine::Rendering
 			return data->color_fmt;
 		}
 
+		/**
+		 * Get the size of the pixel copy kept in memory and of the image
+		 */
+		[[nodiscard]] MemoryUsage getMemoryUsage() const;
+
 	private:
 		std::unique_ptr<TextureData> data;
 	};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "SceneFormat.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Engine
+{
+	/**
+	 * Read-only view of a compiled scene
+	 *
+	 * Compiled files are mapped into memory and their records are read in place.
+	 * The whole file is validated on construction, so the getters never fail.
+	 */
+	class CompiledScene final
+	{
+	public:
+		/**
+		 * Map a compiled scene file
+		 */
+		explicit CompiledScene(const std::filesystem::path& file_path);
+
+		/**
+		 * Take over a scene compiled in memory, see @ref SceneCompiler::compile()
+		 */
+		explicit CompiledScene(std::vector<std::byte>&& with_bytes);
+
+		~CompiledScene();
+
+		/**
+		 * Check the magic and format version of a compiled scene file
+		 * without reading the rest of it
+		 *
+		 * @return False if the file can't be read, isn't a compiled scene or has another version
+		 */
+		[[nodiscard]] static bool isCurrentFormat(const std::filesystem::path& file_path);
+
+		CompiledScene(const CompiledScene&)			   = delete;
+		CompiledScene& operator=(const CompiledScene&) = delete;
+
+		[[nodiscard]] std::span<const SceneFormat::AssetRecord> getAssets() const noexcept;
+
+		[[nodiscard]] std::span<const SceneFormat::EventHandlerRecord> getEventHandlers(
+		) const noexcept;
+
+		[[nodiscard]] std::span<const SceneFormat::TemplateRecord> getTemplates() const noexcept;
+
+		/**
+		 * Get the supply data of a template
+		 *
+		 * @param range Either supply range of a @ref SceneFormat::TemplateRecord
+		 */
+		[[nodiscard]] std::span<const SceneFormat::SupplyRecord>
+		getSupplyData(const SceneFormat::Section& range) const noexcept;
+
+		[[nodiscard]] std::string_view getString(const SceneFormat::StringRef& ref) const noexcept;
+
+		/**
+		 * Check whether the data was read from a compiled file rather than compiled on load
+		 */
+		[[nodiscard]] bool isMapped() const noexcept
+		{
+			return mapping != nullptr;
+		}
+
+	private:
+		// Only used by scenes compiled in memory or when mapping is not supported
+		std::vector<std::byte> owned_bytes;
+
+		void*  mapping		= nullptr;
+		size_t mapping_size = 0;
+
+		std::span<const std::byte> bytes;
+
+		[[nodiscard]] const SceneFormat::Header& getHeader() const noexcept;
+
+		template <SceneFormat::Record record_t>
+		[[nodiscard]] std::span<const record_t> getSection(const SceneFormat::Section& section
+		) const noexcept;
+
+		/**
+		 * Check that every offset of the scene lies within its data
+		 */
+		void validate() const;
+	};
+} // namespace Engine
@@ -1,22 +1,40 @@
 #pragma once
 
+#include "Rendering/FrustumCuller.hpp"
+#include "Rendering/RenderQueue.hpp"
 #include "Rendering/Transform.hpp"
 #include "Rendering/Vulkan/exports.hpp"
 
 #include "Logging/Logging.hpp"
 
 #include "EventHandling.hpp"
+#include "FrameScheduler.hpp"
+#include "FrameStats.hpp"
+#include "InputRecording.hpp"
+#include "JobSystem.hpp"
 #include "SceneManager.hpp"
 
+#include <bitset>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace Engine
 {
 	class AssetManager;
 	class SceneObject;
 
+	namespace Rendering
+	{
+		class IRenderer;
+		class RenderThread;
+	} // namespace Rendering
+
 	namespace Rendering::Vulkan
 	{
 		class PipelineManager;
@@ -37,6 +55,46 @@ namespace Engine
 
 		uint_fast16_t framerate_target = 0;
 
+		// Record and submit frames on a separate thread
+		bool render_thread = false;
+
+		// Rate of onFixedUpdate events per second (0 = disabled)
+		uint_fast16_t tick_rate = 60;
+
+		// Number of job system workers (0 = one less than the number of cores)
+		size_t job_workers = 0;
+
+		struct HeadlessParams
+		{
+			// Render offscreen without creating a GLFW window
+			bool enabled = false;
+
+			// Stop the engine after this many frames (0 = unlimited)
+			uint_fast64_t frame_limit = 0;
+			// Stop the engine after this many seconds (0 = unlimited)
+			double		  time_limit  = 0.0;
+		} headless;
+
+		struct
+		{
+			// Chrome trace written on exit (empty = none)
+			std::string trace_file;
+			// Number of most recent frames included in traces (0 = all recorded)
+			size_t		trace_frames = 0;
+
+			// Frame statistics summary rewritten periodically (empty = none)
+			std::string stats_file;
+			// Seconds between rewrites of the statistics summary
+			double		stats_interval = 5.0;
+		} profiling;
+
+		struct
+		{
+			// Memory that resident scenes may use before inactive ones are unloaded (0 = unlimited)
+			size_t cpu_budget = 0;
+			size_t gpu_budget = 0;
+		} scene_memory;
+
 		std::string game_path	= "game/";
 		std::string scene_path	= "scenes/";
 		std::string shader_path = "shaders/";
@@ -54,8 +112,58 @@ namespace Engine
 
 		void configFile(std::string path);
 
+		/**
+		 * Force headless mode, overriding the "headless" section of the config file
+		 *
+		 * @param params Parameters to use instead of the configured ones
+		 */
+		void setHeadless(EngineConfig::HeadlessParams params)
+		{
+			headless_override = params;
+		}
+
+		/**
+		 * Record all input consumed by the engine, the recording is saved to @p path on exit
+		 */
+		void recordInput(const std::string& path);
+
+		/**
+		 * Replay input recorded by @ref recordInput() instead of reading the window
+		 *
+		 * Frames are simulated with the recorded delta times and the engine stops
+		 * after the last recorded frame.
+		 */
+		void replayInput(const std::string& path);
+
+		/**
+		 * Seed math.random of all scripts of @p scene when recording or replaying input
+		 */
+		void seedScriptRandom(Scene& scene);
+
 		void stop();
 
+		/**
+		 * Wait for the render thread to finish drawing the current frame,
+		 * has to be called before Vulkan resources in use by the last frame are created or destroyed
+		 *
+		 * @note Does nothing if the render thread is disabled
+		 */
+		void syncRenderThread();
+
+		/**
+		 * Write the recorded profiling zones of the last frames as a Chrome trace
+		 *
+		 * @param path Path of the JSON file to write
+		 */
+		void writeTrace(const std::string& path);
+
+		/**
+		 * Write a JSON summary of the timings of recent frames
+		 *
+		 * @param path Path of the JSON file to write
+		 */
+		void writeFrameStats(const std::string& path);
+
 		/**
 		 * Function that throws an exception when called.
 		 *
@@ -87,6 +195,80 @@ namespace Engine
 			return last_delta_time;
 		}
 
+		/**
+		 * Get the fraction of a fixed tick that has elapsed since the last onFixedUpdate event
+		 *
+		 * @return Value in range [0, 1), to blend between previous and current simulation states
+		 */
+		[[nodiscard]] double getInterpolationAlpha() const
+		{
+			return interpolation_alpha;
+		}
+
+		/**
+		 * Get the fraction of last frame's slack time that was spent running idle tasks
+		 *
+		 * @return Value in range [0, 1], 0 when the framerate is not limited
+		 */
+		[[nodiscard]] double getIdleUtilisation() const
+		{
+			return frame_scheduler.getLastStats().utilisation;
+		}
+
+		/**
+		 * Get the time left in last frame after all frame work was done
+		 *
+		 * @return Slack in milliseconds, 0 when the framerate is not limited or the frame overran
+		 */
+		[[nodiscard]] double getIdleSlack() const
+		{
+			return frame_scheduler.getLastStats().slack_ms;
+		}
+
+		/**
+		 * Check whether a key is currently held down
+		 *
+		 * @param keycode GLFW key code of the key
+		 * @return True if the key is down, false if it is up or the key code is invalid
+		 */
+		[[nodiscard]] bool isKeyDown(int keycode) const;
+
+		/**
+		 * Get the mouse movement gathered during the current frame
+		 *
+		 * @return Movement in screen pixels, zero when the mouse did not move
+		 */
+		[[nodiscard]] glm::dvec2 getMouseDelta() const
+		{
+			return frame_mouse_delta;
+		}
+
+		/**
+		 * Get the timings of recent frames
+		 */
+		[[nodiscard]] const FrameStats& getFrameStats() const
+		{
+			return frame_stats;
+		}
+
+		/**
+		 * Set a named value written along with the frame statistics
+		 */
+		void setStatCounter(const std::string& name, double value)
+		{
+			frame_stats.setCounter(name, value);
+		}
+
+		[[nodiscard]] FrameScheduler& getFrameScheduler()
+		{
+			return frame_scheduler;
+		}
+
+		[[nodiscard]] Base::JobSystem* getJobSystem()
+		{
+			return job_system.get();
+		}
+
 		[[nodiscard]] std::shared_ptr<Logging::Logger> getLogger() const
 		{
 			return logger;
@@ -111,10 +293,41 @@ namespace Engine
 	private:
 		std::string config_path;
 
+		// Start of run(), time to first frame is measured from here
+		std::chrono::steady_clock::time_point run_start;
+
 		double last_delta_time = 0.0;
 
+		// Input events of the current frame, kept to reuse the allocation
+		std::vector<EventHandling::InputEvent> frame_inputs;
+		glm::dvec2							   frame_mouse_delta{};
+
+		// Keys currently held down, indexed by GLFW key code
+		std::bitset<EventHandling::key_code_count> key_states;
+
+		enum class InputMode : uint8_t
+		{
+			live,
+			record,
+			replay,
+		};
+
+		InputMode	   input_mode = InputMode::live;
+		std::string	   input_recording_path;
+		InputRecording input_recording;
+		size_t		   replay_frame = 0;
+
+		// Fixed timestep state
+		double fixed_accumulator   = 0.0;
+		double interpolation_alpha = 0.0;
+
 		EngineConfig config;
 
+		std::optional<EngineConfig::HeadlessParams> headless_override;
+
+		FrameScheduler frame_scheduler;
+		FrameStats	   frame_stats;
+
 		// Engine parts
 		std::shared_ptr<Logging::Logger> logger;
 		std::shared_ptr<AssetManager>	 asset_manager;
@@ -123,13 +336,86 @@ namespace Engine
 
 		std::shared_ptr<Rendering::Vulkan::PipelineManager> pipeline_manager;
 
+		std::unique_ptr<Base::JobSystem> job_system;
+
+		std::unique_ptr<Rendering::RenderThread> render_thread;
+
+		// Camera matrices of the current frame, shared by all objects
+		Rendering::FrameUniformData frame_data;
+
+		Rendering::FrustumCuller frustum_culler;
+
+		// Snapshot items whose renderers need resource updates, filled after the render thread is idle
+		std::vector<std::pair<size_t, Rendering::IRenderer*>> snapshot_deferred;
+
+		// Draws of the frame when rendering without the render thread
+		std::vector<Rendering::RenderItem> direct_items;
+		Rendering::RenderQueue			   direct_queue;
+
+		// Draw and bind counts of the last sorted frame
+		Rendering::RenderQueue::Stats render_stats;
+
 		static void renderCallback(
 			Rendering::Vulkan::CommandBuffer* command_buffer,
 			uint32_t						  current_frame,
 			void*							  engine
 		);
 
-		void handleInput(double delta_time);
+		/**
+		 * Build the meshes of all objects in a scene,
+		 * generating them on the job system and uploading them in one batch
+		 */
+		void buildScene(const std::shared_ptr<Scene>& scene);
+
+		/**
+		 * Build meshes requested since the last frame and upload them with a single submission
+		 *
+		 * Nothing waits for the upload, frames drawing the meshes are submitted after it.
+		 *
+		 * @note The render thread has to be idle
+		 */
+		void uploadPendingMeshes();
+
+		/**
+		 * Fill the back snapshot of the render thread with all objects of the current scene
+		 *
+		 * @note Renderers that need resource updates are only reserved a slot
+		 *       and prepared by @ref submitSnapshot()
+		 */
+		void gatherSnapshot();
+
+		/**
+		 * Prepare deferred renderers and publish the snapshot to the render thread
+		 *
+		 * @note The render thread has to be idle
+		 */
+		void submitSnapshot();
+
+		/**
+		 * Gather the input of this frame (or take it from the replayed recording) and fire input events
+		 *
+		 * @param delta_time Measured time elapsed since the last frame
+		 * @return Delta time to simulate the frame with, the recorded one when replaying
+		 */
+		[[nodiscard]] double handleInput(double delta_time);
+
+		/**
+		 * Fires as many onFixedUpdate events as fit into the accumulated time
+		 *
+		 * @param delta_time Time elapsed since the last call
+		 * @return Sum of exit codes of all fired events
+		 */
+		[[nodiscard]] int handleFixedUpdate(double delta_time);
+
+		/**
+		 * Refresh the engine-wide counters written along with the frame statistics
+		 */
+		void updateStatCounters();
+
+		/**
+		 * Register the idle tasks run by the engine itself
+		 */
+		void registerIdleTasks();
 
 		void engineLoop();
 
@@ -2,7 +2,10 @@
 
 #include "glm/vec2.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <string_view>
 
 namespace Engine
 {
@@ -16,17 +19,45 @@ namespace Engine::EventHandling
 		onInit	 = 1,
 		onUnload = 2, // currently unused
 
-		onUpdate = 8,
+		onUpdate	  = 8,
+		onFixedUpdate = 9,
 
 		onKeyDown = 16,
 		onKeyUp	  = 18,
 
+		// All input events of a frame in a single call
+		onInput = 20,
+
 		onMouseMoved = 24,
 
+		// A scene requested with preloadScene is resident
+		onSceneLoaded = 32,
+
 		minEnum = 0x00,
 		maxEnum = 0xFF,
 	};
 
+	// Upper bound of key codes carried by input events (GLFW_KEY_LAST is 348)
+	constexpr size_t key_code_count = 512;
+
+	/**
+	 * A single input event, as delivered in batches by the onInput event
+	 */
+	struct InputEvent final
+	{
+		enum class Type : uint8_t
+		{
+			keyDown,
+			keyUp,
+			mouseMoved,
+		};
+
+		Type type;
+
+		uint16_t   keycode = 0; // keyDown/keyUp
+		glm::dvec2 mouse{};		// mouseMoved
+	};
+
 	struct Event final
 	{
 		const EventType event_type;
@@ -34,11 +65,21 @@ namespace Engine::EventHandling
 
 		// delta time shall be specified for every event
 		double delta_time = 0.0;
+
+		// Fraction of a fixed tick elapsed since the last onFixedUpdate,
+		// used to interpolate between the last two simulation states (onUpdate event)
+		double interpolation_alpha = 0.0;
 		union {						// event specific data
 			uint16_t   keycode = 0; // onKeyDown/onKeyUp events
 			glm::dvec2 mouse;		// onMouseMoved event
 		};
 
+		// Input events gathered during the frame, in order of arrival (onInput event)
+		std::span<const InputEvent> inputs;
+
+		// Name of the scene that finished loading (onSceneLoaded event)
+		std::string_view scene_name;
+
 		Event(Engine* const with_engine, EventType eventtype)
 			: event_type(eventtype), raised_from(with_engine)
 		{}
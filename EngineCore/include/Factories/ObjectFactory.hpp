@@ -117,6 +117,28 @@ namespace Engine::Factories::ObjectFactory
 
 	SceneObject* instantiateObjectTemplate(Engine* with_engine, ObjectTemplate& from_template);
 
+	/**
+	 * Create a mesh builder on its own, not attached to any renderer
+	 *
+	 * @param with_mesh_builder       Desired MeshBuilder type.
+	 * @param meshbuilder_supply_data Data supplied to the builder after construction.
+	 *
+	 * @return The created builder, owned by the caller
+	 */
+	Rendering::IMeshBuilder* createMeshBuilder(
+		Engine*												 with_engine,
+		EnumStringConvertor<MeshBuilderType>				 with_mesh_builder,
+		const std::vector<Rendering::MeshBuilderSupplyData>& meshbuilder_supply_data
+	);
+
+	/**
+	 * Whether builders of a type can share one mesh between objects supplied the same data,
+	 * decided by the type alone without creating a builder
+	 *
+	 * @param with_mesh_builder Desired MeshBuilder type.
+	 */
+	[[nodiscard]] bool isMeshShareable(EnumStringConvertor<MeshBuilderType> with_mesh_builder);
+
 	using supply_data_value_t = std::variant<std::monostate, void*, std::string>;
 
 	Rendering::RendererSupplyData generateRendererSupplyData(
@@ -15,14 +15,39 @@ namespace Engine::Factories
 	class TextureFactory : public InternalEngineObject
 	{
 	public:
+		/**
+		 * Pixels of a decoded image, not yet uploaded to the GPU
+		 */
+		struct DecodedImage
+		{
+			std::vector<unsigned char> data;
+			Rendering::ImageSize	   size;
+		};
+
 		using InternalEngineObject::InternalEngineObject;
 
+		/**
+		 * Decode a PNG file
+		 *
+		 * @note Doesn't use the Vulkan instance, safe to call from any thread
+		 */
+		[[nodiscard]] DecodedImage decodeImage(const std::filesystem::path& path) const;
+
 		[[nodiscard]] std::shared_ptr<Rendering::Texture> createTexture(
 			const std::filesystem::path& path,
 			vk::Filter					 filtering		= vk::Filter::eLinear,
 			vk::SamplerAddressMode sampler_address_mode = vk::SamplerAddressMode::eRepeat
 		);
 
+		/**
+		 * Create a texture from an already decoded image
+		 */
+		[[nodiscard]] std::shared_ptr<Rendering::Texture> createTexture(
+			DecodedImage		   image,
+			vk::Filter			   filtering			= vk::Filter::eLinear,
+			vk::SamplerAddressMode sampler_address_mode = vk::SamplerAddressMode::eRepeat
+		);
+
 	private:
 		int createTextureInternal(
 			std::unique_ptr<Rendering::TextureData>& texture_data,
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+	/**
+	 * Fills the time left until a frame deadline with idle tasks,
+	 * then waits out the rest of the frame without busy-spinning a core
+	 */
+	class FrameScheduler final
+	{
+	public:
+		using clock_t = std::chrono::steady_clock;
+
+		/**
+		 * Idle task callback
+		 *
+		 * @param budget Time the task may take before the frame deadline
+		 * @return Whether the task has more work to do this frame
+		 */
+		using idle_task_t = std::function<bool(clock_t::duration budget)>;
+
+		struct IdleStats
+		{
+			// Time between the end of frame work and the deadline
+			double	 slack_ms	 = 0.0;
+			// Part of the slack spent running idle tasks
+			double	 task_ms	 = 0.0;
+			// task_ms / slack_ms
+			double	 utilisation = 0.0;
+			// Number of idle task calls
+			uint32_t task_calls	 = 0;
+		};
+
+		/**
+		 * Register an idle task, tasks are called round-robin while there is time left in a frame
+		 *
+		 * @param name Name of the task, has to be unique
+		 * @param task Callback to run
+		 */
+		void addIdleTask(const std::string& name, idle_task_t task);
+
+		void removeIdleTask(const std::string& name);
+
+		/**
+		 * Run idle tasks while time remains, then wait until @p deadline
+		 *
+		 * @param deadline Point in time at which the next frame should start
+		 */
+		void waitUntil(clock_t::time_point deadline);
+
+		/**
+		 * Get the statistics of the last call to @ref waitUntil()
+		 */
+		[[nodiscard]] const IdleStats& getLastStats() const
+		{
+			return last_stats;
+		}
+
+		/**
+		 * Get the utilisation averaged over all frames since construction
+		 */
+		[[nodiscard]] double getAverageUtilisation() const
+		{
+			return frame_count == 0 ? 0.0 : utilisation_sum / static_cast<double>(frame_count);
+		}
+
+	private:
+		struct IdleTask
+		{
+			std::string name;
+			// Name used for profiling zones, valid for the whole program lifetime
+			const char* zone_name;
+			idle_task_t callback;
+			// Cleared when the task reports it has no more work this frame
+			bool		pending;
+		};
+
+		std::vector<IdleTask> tasks;
+		size_t				  next_task = 0;
+
+		// Running estimate of how much longer sleep_until takes than requested
+		clock_t::duration oversleep_estimate = std::chrono::milliseconds(1);
+
+		IdleStats last_stats;
+		double	  utilisation_sum = 0.0;
+		uint64_t  frame_count	  = 0;
+
+		void runIdleTasks(clock_t::time_point task_deadline);
+		void wait(clock_t::time_point deadline);
+	};
+} // namespace Engine
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace Engine
+{
+	/**
+	 * Collects the timings of recent frames and summarizes them
+	 *
+	 * Samples are kept in fixed-size ring buffers, so recording a frame never allocates
+	 * and summaries always describe the last @ref history_size frames.
+	 */
+	class FrameStats final
+	{
+	public:
+		enum class Metric : uint8_t
+		{
+			frame, // Time between the starts of two frames
+			work,  // Time spent in event, draw and poll
+			event,
+			draw,
+			poll,
+		};
+		static constexpr size_t metric_count = 5;
+
+		static constexpr size_t history_size		   = 1024;
+		static constexpr size_t histogram_bucket_count = 16;
+
+		struct Summary
+		{
+			double p50	= 0.0;
+			double p95	= 0.0;
+			double p99	= 0.0;
+			double max	= 0.0;
+			double mean = 0.0;
+		};
+
+		using histogram_t = std::array<uint32_t, histogram_bucket_count>;
+
+		/**
+		 * @param with_budget_ms Time a frame may take, used for over-budget counts and histograms
+		 */
+		explicit FrameStats(double with_budget_ms = 1000.0 / 60.0);
+
+		void setBudget(double with_budget_ms)
+		{
+			budget_ms = with_budget_ms;
+		}
+
+		[[nodiscard]] double getBudget() const
+		{
+			return budget_ms;
+		}
+
+		/**
+		 * Record the timings of one frame, all values are in milliseconds
+		 */
+		void record(double frame_ms, double event_ms, double draw_ms, double poll_ms);
+
+		/**
+		 * Summarize the recorded samples of a metric
+		 *
+		 * @note Sorts a copy of the samples, avoid calling multiple times per frame
+		 */
+		[[nodiscard]] Summary getSummary(Metric metric) const;
+
+		/**
+		 * Get a histogram of recent work times
+		 *
+		 * Buckets are 1/8 of the budget wide, the last bucket also contains all longer frames.
+		 */
+		[[nodiscard]] histogram_t getHistogram() const;
+
+		/**
+		 * Get the number of frames whose work took longer than the budget since construction
+		 */
+		[[nodiscard]] uint64_t getOverBudgetCount() const
+		{
+			return over_budget_count;
+		}
+
+		/**
+		 * Get the number of frames recorded since construction
+		 */
+		[[nodiscard]] uint64_t getFrameCount() const
+		{
+			return frame_count;
+		}
+
+		/**
+		 * Set a named value written along with the frame statistics (e.g. object counts, memory usage)
+		 */
+		void setCounter(const std::string& name, double value)
+		{
+			counters[name] = value;
+		}
+
+		/**
+		 * Serialize all summaries, the histogram and counters
+		 *
+		 * @return JSON text
+		 */
+		[[nodiscard]] std::string toJson() const;
+
+	private:
+		std::array<std::array<double, history_size>, metric_count> samples{};
+
+		// Index the next sample is written to
+		size_t next_sample = 0;
+
+		double	 budget_ms;
+		uint64_t over_budget_count = 0;
+		uint64_t frame_count	   = 0;
+
+		std::map<std::string, double> counters;
+
+		[[nodiscard]] size_t getSampleCount() const
+		{
+			return frame_count < history_size ? static_cast<size_t>(frame_count) : history_size;
+		}
+	};
+} // namespace Engine
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "EventHandling.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+	/**
+	 * Input consumed by the engine during a session, frame by frame
+	 *
+	 * Replaying a recording feeds the same input with the same delta times
+	 * and random seed, making whole sessions reproducible.
+	 */
+	struct InputRecording final
+	{
+		struct Frame
+		{
+			// Simulated delta time of the frame in seconds
+			double delta_time = 0.0;
+
+			std::vector<EventHandling::InputEvent> inputs;
+		};
+
+		// Seed of the Lua math.random state
+		uint32_t seed = 0;
+
+		std::vector<Frame> frames;
+
+		/**
+		 * Load a recording from a JSON file
+		 *
+		 * @param path Path of the file to load
+		 * @throws Engine exception if the file can't be opened or isn't a valid recording
+		 */
+		static InputRecording load(const std::string& path);
+
+		/**
+		 * Save the recording as a JSON file
+		 *
+		 * @param path Path of the file to write
+		 */
+		void save(const std::string& path) const;
+	};
+} // namespace Engine
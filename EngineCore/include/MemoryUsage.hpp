@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Engine
+{
+	/**
+	 * Estimated memory held by an asset, scene or other resource
+	 */
+	struct MemoryUsage
+	{
+		size_t cpu_bytes = 0;
+		size_t gpu_bytes = 0;
+
+		MemoryUsage& operator+=(const MemoryUsage& other) noexcept
+		{
+			cpu_bytes += other.cpu_bytes;
+			gpu_bytes += other.gpu_bytes;
+			return *this;
+		}
+
+		MemoryUsage& operator-=(const MemoryUsage& other) noexcept
+		{
+			cpu_bytes -= other.cpu_bytes;
+			gpu_bytes -= other.gpu_bytes;
+			return *this;
+		}
+	};
+} // namespace Engine
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace Engine
+{
+	/**
+	 * Generational reference to an object in an @ref ObjectStorage
+	 *
+	 * Handles stay valid while the storage moves objects around
+	 * and become stale (instead of dangling) once their object is removed.
+	 */
+	struct ObjectHandle
+	{
+		static constexpr uint32_t invalid_index = std::numeric_limits<uint32_t>::max();
+
+		// Generations wrap at this many bits so that packed handles are exactly representable as a double
+		static constexpr uint32_t generation_bits = 20;
+		static constexpr uint32_t generation_mask = (1u << generation_bits) - 1;
+
+		uint32_t index		= invalid_index;
+		uint32_t generation = 0;
+
+		[[nodiscard]] bool isValid() const noexcept
+		{
+			return index != invalid_index;
+		}
+
+		[[nodiscard]] uint64_t pack() const noexcept
+		{
+			return (static_cast<uint64_t>(generation) << 32) | index;
+		}
+
+		[[nodiscard]] static ObjectHandle unpack(uint64_t packed) noexcept
+		{
+			return {
+				.index		= static_cast<uint32_t>(packed),
+				.generation = static_cast<uint32_t>(packed >> 32)
+			};
+		}
+
+		bool operator==(const ObjectHandle&) const = default;
+	};
+} // namespace Engine
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "Rendering/Bounds.hpp"
+#include "Rendering/Transform.hpp"
+
+#include "ObjectHandle.hpp"
+#include "SpatialIndex.hpp"
+#include "glm/gtc/quaternion.hpp"
+#include "glm/mat4x4.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine::Rendering
+{
+	class IRenderer;
+}
+
+namespace Engine
+{
+	class SceneObject;
+
+	/**
+	 * Dense storage of scene objects addressed by generational handles
+	 *
+	 * Objects, their renderers and transforms are kept in parallel arrays without holes
+	 * (removal moves the last object into the freed place), so walking all objects is a linear
+	 * walk over memory. Names are only a secondary index.
+	 *
+	 * World matrices are cached, changing a transform only marks the object dirty.
+	 * @ref updateTransforms() then recomputes the dirty objects and their descendants once per frame,
+	 * together with their world-space bounds in the @ref SpatialIndex.
+	 *
+	 * @note Objects are not deleted by the storage, the owner has to do that
+	 */
+	class ObjectStorage final
+	{
+	public:
+		ObjectStorage() = default;
+
+		ObjectStorage(const ObjectStorage&)			   = delete;
+		ObjectStorage& operator=(const ObjectStorage&) = delete;
+
+		/**
+		 * Take over an object, its current transform is moved into the storage
+		 *
+		 * @throws Engine exception if the name is taken or the object is already stored
+		 */
+		ObjectHandle insert(const std::string& name, SceneObject* object);
+
+		/**
+		 * Release an object, its transform is moved back into the object
+		 *
+		 * @return The object (now owned by the caller) or nullptr if the handle is stale
+		 */
+		SceneObject* erase(ObjectHandle handle);
+
+		/**
+		 * @return The object or nullptr if the handle is stale
+		 */
+		[[nodiscard]] SceneObject* get(ObjectHandle handle) const noexcept;
+
+		/**
+		 * @return Handle of the named object or an invalid handle
+		 */
+		[[nodiscard]] ObjectHandle find(const std::string& name) const noexcept;
+
+		[[nodiscard]] bool contains(ObjectHandle handle) const noexcept
+		{
+			return getDenseIndex(handle) != ObjectHandle::invalid_index;
+		}
+
+		[[nodiscard]] size_t count() const noexcept
+		{
+			return objects.size();
+		}
+
+		[[nodiscard]] Rendering::Transform getTransform(ObjectHandle handle) const;
+
+		void setPosition(ObjectHandle handle, const glm::vec3& position);
+		void setSize(ObjectHandle handle, const glm::vec3& size);
+		void setRotation(ObjectHandle handle, const glm::vec3& rotation);
+
+		/**
+		 * Schedule the world matrix of an object and its descendants to be recomputed
+		 */
+		void markDirty(ObjectHandle handle);
+
+		/**
+		 * Recompute world matrices of all dirty subtrees, parents before their children,
+		 * and hand them to the renderers
+		 *
+		 * Parents not stored here are treated as if the object had no parent.
+		 *
+		 * @return Number of recomputed world matrices
+		 */
+		size_t updateTransforms();
+
+		/**
+		 * Refresh world bounds of objects whose mesh was rebuilt without their transform changing
+		 */
+		void updateMeshBounds();
+
+		[[nodiscard]] const SpatialIndex& getSpatialIndex() const noexcept
+		{
+			return spatial_index;
+		}
+
+		/*
+		 * Dense columns, element i of every column belongs to the same object
+		 */
+
+		[[nodiscard]] std::span<SceneObject* const> getObjects() const noexcept
+		{
+			return objects;
+		}
+
+		[[nodiscard]] std::span<Rendering::IRenderer* const> getRenderers() const noexcept
+		{
+			return renderers;
+		}
+
+		[[nodiscard]] std::span<const std::string> getNames() const noexcept
+		{
+			return names;
+		}
+
+		[[nodiscard]] std::span<const glm::vec3> getPositions() const noexcept
+		{
+			return positions;
+		}
+
+		[[nodiscard]] std::span<const glm::vec3> getSizes() const noexcept
+		{
+			return sizes;
+		}
+
+		[[nodiscard]] std::span<const glm::vec3> getRotations() const noexcept
+		{
+			return rotations;
+		}
+
+		/**
+		 * @note Only up to date after @ref updateTransforms()
+		 */
+		[[nodiscard]] std::span<const glm::mat4> getWorldMatrices() const noexcept
+		{
+			return world_matrices;
+		}
+
+		/**
+		 * @note Only up to date after @ref updateTransforms() and @ref updateMeshBounds()
+		 */
+		[[nodiscard]] std::span<const Rendering::AABB> getWorldBounds() const noexcept
+		{
+			return world_bounds;
+		}
+
+	private:
+		struct Slot
+		{
+			uint32_t generation	 = 0;
+			uint32_t dense_index = ObjectHandle::invalid_index;
+		};
+
+		std::vector<Slot>	  slots;
+		std::vector<uint32_t> free_slots;
+
+		std::vector<SceneObject*>		   objects;
+		std::vector<Rendering::IRenderer*> renderers;
+		std::vector<std::string>		   names;
+		std::vector<glm::vec3>			   positions;
+		std::vector<glm::vec3>			   sizes;
+		std::vector<glm::vec3>			   rotations;
+
+		// Rotations converted once when set, instead of every time a matrix is built
+		std::vector<glm::quat>		 local_rotations;
+		std::vector<glm::mat4>		 world_matrices;
+		std::vector<Rendering::AABB> world_bounds;
+		std::vector<uint8_t>		 dirty;
+
+		// Mesh revision the world bounds were computed from
+		std::vector<uint32_t> mesh_revisions;
+
+		// Slot index of every dense element, to fix up slots when elements move
+		std::vector<uint32_t> dense_slots;
+
+		std::unordered_map<std::string, ObjectHandle> name_index;
+
+		// Objects marked dirty since the last update, may contain stale handles
+		std::vector<ObjectHandle> dirty_list;
+
+		// Reused by updateTransforms() to walk subtrees without recursion
+		std::vector<SceneObject*> update_stack;
+
+		SpatialIndex spatial_index;
+
+		/**
+		 * @return Index into the dense columns or @ref ObjectHandle::invalid_index if stale
+		 */
+		[[nodiscard]] uint32_t getDenseIndex(ObjectHandle handle) const noexcept;
+
+		/**
+		 * @throws Engine exception if the handle is stale
+		 */
+		[[nodiscard]] uint32_t getDenseIndexChecked(ObjectHandle handle) const;
+
+		void markDirtyDense(uint32_t dense_index);
+
+		/**
+		 * Recompute the world matrices of the subtree rooted at @p root
+		 *
+		 * @return Number of recomputed world matrices
+		 */
+		size_t updateSubtree(SceneObject* root);
+
+		/**
+		 * Recompute world bounds from the world matrix and move the object in the spatial index
+		 */
+		void updateBounds(uint32_t dense_index);
+	};
+} // namespace Engine
@@ -1,5 +1,6 @@
 #include "PlatformSemantics.hpp"
 
+#include <cstdint>
 #include <memory>
 
 namespace Logging
@@ -23,6 +24,24 @@ namespace Engine
 
 		CMEP_EXPORT void configFile(const char* path);
 
+		/**
+		 * Run without a window, stopping after a number of frames or seconds
+		 *
+		 * @param frame_limit Frames to run for, 0 = unlimited
+		 * @param time_limit Seconds to run for, 0 = unlimited
+		 */
+		CMEP_EXPORT void setHeadless(uint64_t frame_limit, double time_limit);
+
+		/**
+		 * Record all input of the session, saved to @p path on exit
+		 */
+		CMEP_EXPORT void recordInput(const char* path);
+
+		/**
+		 * Replay input recorded by @ref recordInput() on the recorded clock
+		 */
+		CMEP_EXPORT void replayInput(const char* path);
+
 	private:
 		std::unique_ptr<Engine> d_engine;
 	};
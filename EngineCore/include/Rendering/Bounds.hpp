@@ -0,0 +1,51 @@
+#pragma once
+
+#include "glm/common.hpp"
+#include "glm/mat4x4.hpp"
+#include "glm/vec3.hpp"
+#include "glm/vec4.hpp"
+
+namespace Engine::Rendering
+{
+	/**
+	 * Axis-aligned bounding box
+	 */
+	struct AABB
+	{
+		glm::vec3 min{};
+		glm::vec3 max{};
+
+		[[nodiscard]] glm::vec3 getCenter() const
+		{
+			return (min + max) * 0.5f;
+		}
+
+		// Half of the size along each axis
+		[[nodiscard]] glm::vec3 getExtent() const
+		{
+			return (max - min) * 0.5f;
+		}
+
+		[[nodiscard]] bool overlaps(const AABB& other) const
+		{
+			return min.x <= other.max.x && other.min.x <= max.x && min.y <= other.max.y &&
+				   other.min.y <= max.y && min.z <= other.max.z && other.min.z <= max.z;
+		}
+
+		/**
+		 * Get the box enclosing this box after a transformation
+		 */
+		[[nodiscard]] AABB transformed(const glm::mat4& matrix) const
+		{
+			const glm::vec3 local_extent = getExtent();
+
+			// The extent is projected onto the world axes
+			const glm::vec3 center = glm::vec3(matrix * glm::vec4(getCenter(), 1.0f));
+			const glm::vec3 extent = glm::abs(glm::vec3(matrix[0])) * local_extent.x +
+									 glm::abs(glm::vec3(matrix[1])) * local_extent.y +
+									 glm::abs(glm::vec3(matrix[2])) * local_extent.z;
+
+			return {.min = center - extent, .max = center + extent};
+		}
+	};
+} // namespace Engine::Rendering
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Rendering/Bounds.hpp"
+#include "Rendering/Vulkan/common.hpp"
+
+#include "glm/mat4x4.hpp"
+#include "glm/vec3.hpp"
+#include "glm/vec4.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine::Rendering
+{
+	class IRenderer;
+
+	/**
+	 * Planes of a view frustum, normals point inwards
+	 */
+	struct Frustum
+	{
+		std::array<glm::vec4, 6> planes;
+
+		/**
+		 * Extract the planes of a view-projection matrix
+		 */
+		[[nodiscard]] static Frustum fromMatrix(const glm::mat4& view_projection);
+	};
+
+	/**
+	 * Decides which renderers are on screen before any draw is recorded
+	 *
+	 * World-space bounds are packed into one array per component,
+	 * so that each frustum plane is tested against several boxes at once.
+	 */
+	class FrustumCuller final
+	{
+	public:
+		/**
+		 * Cull all renderers of a scene against the frame's frusta
+		 *
+		 * Renderers that still have to build their mesh or descriptors are never culled.
+		 *
+		 * @param renderers    Renderers to cull
+		 * @param world_bounds World-space bounds of each renderer's mesh
+		 * @param frame_data   View-projections of the frame
+		 */
+		void cull(
+			std::span<IRenderer* const> renderers,
+			std::span<const AABB>		world_bounds,
+			const FrameUniformData&		frame_data
+		);
+
+		/**
+		 * @note Indices past the last cull are considered visible
+		 */
+		[[nodiscard]] bool isVisible(size_t index) const noexcept
+		{
+			return index >= visible.size() || visible[index] != 0;
+		}
+
+		/**
+		 * Get the number of renderers culled by the last @ref cull()
+		 */
+		[[nodiscard]] size_t getCulledCount() const noexcept
+		{
+			return culled_count;
+		}
+
+	private:
+		/**
+		 * World-space boxes of all renderers drawn with one projection
+		 */
+		struct PackedBounds
+		{
+			std::vector<uint32_t> indices;
+
+			std::vector<float> center_x;
+			std::vector<float> center_y;
+			std::vector<float> center_z;
+			std::vector<float> extent_x;
+			std::vector<float> extent_y;
+			std::vector<float> extent_z;
+
+			void clear();
+			void add(uint32_t index, const glm::vec3& center, const glm::vec3& extent);
+		};
+
+		// Indexed by ProjectionType
+		std::array<PackedBounds, 2> bounds;
+
+		std::vector<uint8_t> visible;
+		std::vector<uint8_t> test_results;
+
+		size_t culled_count = 0;
+	};
+} // namespace Engine::Rendering
@@ -12,14 +12,16 @@ namespace Engine::Rendering
 
 		using IMeshBuilder::supplyData;
 
-		void build() override;
-
 		[[nodiscard]] vk::PrimitiveTopology getSupportedTopology() const noexcept override
 		{
 			return vk::PrimitiveTopology::eLineList;
 		}
 
-		static constexpr bool supports_2d = false;
-		static constexpr bool supports_3d = true;
+		static constexpr bool supports_2d	 = false;
+		static constexpr bool supports_3d	 = true;
+		static constexpr bool mesh_shareable = true;
+
+	private:
+		bool generateMesh() override;
 	};
 } // namespace Engine::Rendering
@@ -13,17 +13,23 @@ namespace Engine::Rendering
 
 		void supplyData(const MeshBuilderSupplyData& data) override;
 
-		void build() override;
-
 		[[nodiscard]] vk::PrimitiveTopology getSupportedTopology() const noexcept override
 		{
 			return vk::PrimitiveTopology::eTriangleList;
 		}
 
+		// Generators call into Lua states that are shared with other scripts
+		[[nodiscard]] bool isGenerateThreadSafe() const noexcept override
+		{
+			return false;
+		}
+
 		static constexpr bool supports_2d = true;
 		static constexpr bool supports_3d = true;
 
 	private:
 		GeneratorData script_data;
+
+		bool generateMesh() override;
 	};
 } // namespace Engine::Rendering
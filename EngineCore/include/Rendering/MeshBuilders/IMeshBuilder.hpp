@@ -5,6 +5,9 @@
 
 #include "InternalEngineObject.hpp"
 
+#include <cstddef>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace Engine::Rendering
@@ -15,10 +18,7 @@ namespace Engine::Rendering
 		IMeshBuilder() = delete;
 		IMeshBuilder(Engine* engine);
 
-		virtual ~IMeshBuilder()
-		{
-			delete context.vbo;
-		}
+		virtual ~IMeshBuilder() = default;
 
 		// Always call IMeshBuilder::SupplyData when overriding!
 		virtual void supplyData(const MeshBuilderSupplyData& data)
@@ -35,7 +35,79 @@ namespace Engine::Rendering
 			world_pos = with_world_position;
 		}
 
-		virtual void build() = 0;
+		/**
+		 * Generate the mesh and upload it
+		 */
+		void build()
+		{
+			generate();
+
+			if (has_pending_upload) { context.rebuildVBO(instance, mesh); }
+			has_pending_upload = false;
+			needs_rebuild	   = false;
+		}
+
+		/**
+		 * CPU part of @ref build(), may run on a worker thread if @ref isGenerateThreadSafe()
+		 */
+		void generate()
+		{
+			has_pending_upload = generateMesh();
+		}
+
+		/**
+		 * GPU part of @ref build(), records the upload of the generated mesh (if any)
+		 *
+		 * @param command_buffer Command buffer in the recording state
+		 * @param staging        Staging buffers that have to outlive the submission are added here
+		 */
+		void upload(
+			Vulkan::CommandBuffer&								  command_buffer,
+			std::vector<std::unique_ptr<Vulkan::StagingBuffer>>& staging
+		)
+		{
+			if (has_pending_upload)
+			{
+				context.recordVBO(instance, command_buffer, mesh, staging.emplace_back());
+			}
+			has_pending_upload = false;
+			needs_rebuild	   = false;
+		}
+
+		/**
+		 * Use a mesh built by another builder instead of building one
+		 *
+		 * The vertex buffer is shared, a later rebuild replaces it for this builder only.
+		 *
+		 * @param with_context Context of a builder that has finished building
+		 */
+		void adoptMesh(const MeshBuildContext& with_context)
+		{
+			// Frames in flight may still draw a mesh this builder built on its own
+			if (context.vbo != with_context.vbo)
+			{
+				instance->getDeletionQueue()->retire(std::move(context.vbo));
+			}
+
+			context			   = with_context;
+			has_pending_upload = false;
+			needs_rebuild	   = false;
+		}
+
+		/**
+		 * Whether the mesh depends only on the data supplied to this builder,
+		 * so that builders supplied the same data may share one mesh.
+		 * Builders that can share their mesh hide this with true.
+		 */
+		static constexpr bool mesh_shareable = false;
+
+		/**
+		 * Whether @ref generate() may run concurrently with other builders
+		 */
+		[[nodiscard]] virtual bool isGenerateThreadSafe() const noexcept
+		{
+			return true;
+		}
 
 		[[nodiscard]] virtual vk::PrimitiveTopology
 		getSupportedTopology() const noexcept = 0;
@@ -50,13 +122,31 @@ namespace Engine::Rendering
 			return needs_rebuild;
 		}
 
+		/**
+		 * Get the size of the generated vertices kept in memory
+		 */
+		[[nodiscard]] size_t getMeshMemory() const noexcept
+		{
+			return mesh.capacity() * sizeof(RenderingVertex);
+		}
+
 	protected:
 		std::vector<RenderingVertex> mesh;
 		bool						 needs_rebuild = true;
 
+		// Set when generateMesh() produced a mesh that has not been uploaded yet
+		bool has_pending_upload = false;
+
 		MeshBuildContext  context = {};
 		Vulkan::Instance* instance;
 
 		glm::vec3 world_pos;
+
+		/**
+		 * Generate vertices into @ref mesh, must not touch Vulkan objects
+		 *
+		 * @return Whether a vertex buffer has to be created from @ref mesh
+		 */
+		virtual bool generateMesh() = 0;
 	};
 } // namespace Engine::Rendering
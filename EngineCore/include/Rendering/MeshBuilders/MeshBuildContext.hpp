@@ -1,32 +1,99 @@
 #pragma once
 
+#include "Rendering/Bounds.hpp"
 #include "Rendering/Vulkan/backend.hpp"
 #include "Rendering/Vulkan/exports.hpp"
 
+#include "glm/common.hpp"
+
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace Engine::Rendering
 {
 	struct MeshBuildContext
 	{
-		Vulkan::Buffer* vbo;
-		size_t			vbo_vert_count;
+		// Shared by all objects instanced from the same template
+		std::shared_ptr<Vulkan::Buffer> vbo;
+		size_t							vbo_vert_count;
+
+		// Local-space bounding box of the uploaded mesh, only valid if vbo_vert_count > 0
+		AABB bounds;
 
+		// Incremented whenever a mesh is uploaded, to notice changed bounds
+		uint32_t revision;
+
+		/**
+		 * Upload a mesh with a submission of its own, without waiting for it to finish
+		 *
+		 * Frames submitted afterwards draw the new mesh,
+		 * the previous buffer and the staging buffer are retired to the deletion queue.
+		 */
 		void
 		rebuildVBO(Vulkan::Instance* with_instance, const std::vector<RenderingVertex>& mesh)
 		{
-			delete vbo;
+			auto* command_buffer = with_instance->getCommandPool()->allocateCommandBuffer();
+			std::unique_ptr<Vulkan::StagingBuffer> staging;
+
+			command_buffer->beginOneTime();
+			recordVBO(with_instance, *command_buffer, mesh, staging);
+			command_buffer->barrierTransferToVertexInput();
+			command_buffer->end();
 
-			auto command_buffer = with_instance->getCommandPool()->constructCommandBuffer();
+			command_buffer->queueSubmitAsync(with_instance->getLogicalDevice()->getGraphicsQueue());
+
+			auto* deletion_queue = with_instance->getDeletionQueue();
+			deletion_queue->retire(command_buffer);
+			deletion_queue->retire(std::move(staging));
+		}
+
+		/**
+		 * Record the upload of a mesh into a command buffer being recorded
+		 *
+		 * @param with_instance   Instance to create the buffer with
+		 * @param command_buffer  Command buffer in the recording state
+		 * @param mesh            Vertices to upload
+		 * @param out_staging     Receives the staging buffer, has to outlive the submission
+		 */
+		void recordVBO(
+			Vulkan::Instance*					 with_instance,
+			Vulkan::CommandBuffer&				 command_buffer,
+			const std::vector<RenderingVertex>&	 mesh,
+			std::unique_ptr<Vulkan::StagingBuffer>& out_staging
+		)
+		{
+			// Frames in flight may still be drawing the previous mesh
+			with_instance->getDeletionQueue()->retire(std::move(vbo));
 
-			vbo = new Vulkan::VertexBuffer(
+			vbo = std::make_shared<Vulkan::VertexBuffer>(
 				with_instance->getLogicalDevice(),
 				with_instance->getGraphicMemoryAllocator(),
 				command_buffer,
-				mesh
+				mesh,
+				out_staging
 			);
 			vbo_vert_count = mesh.size();
+
+			updateBounds(mesh);
+		}
+
+	private:
+		void updateBounds(const std::vector<RenderingVertex>& mesh)
+		{
+			revision++;
+
+			if (mesh.empty()) { return; }
+
+			bounds = {.min = mesh.front().pos, .max = mesh.front().pos};
+
+			for (const auto& vertex : mesh)
+			{
+				bounds.min = glm::min(bounds.min, vertex.pos);
+				bounds.max = glm::max(bounds.max, vertex.pos);
+			}
 		}
 	};
 } // namespace Engine::Rendering
@@ -13,8 +13,6 @@ namespace Engine::Rendering
 
 		void supplyData(const MeshBuilderSupplyData& data) override;
 
-		void build() override;
-
 		[[nodiscard]] vk::PrimitiveTopology getSupportedTopology() const noexcept override
 		{
 			return vk::PrimitiveTopology::eTriangleList;
@@ -29,5 +27,7 @@ namespace Engine::Rendering
 		std::string text;
 
 		std::shared_ptr<const Rendering::Font> font = nullptr;
+
+		bool generateMesh() override;
 	};
 } // namespace Engine::Rendering
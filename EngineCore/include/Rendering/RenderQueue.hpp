@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Rendering/Vulkan/common.hpp"
+#include "Rendering/Vulkan/exports.hpp"
+
+#include "glm/vec3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine::Rendering
+{
+	/**
+	 * Everything needed to record the draw of a single object,
+	 * copied out of the renderer so that recording does not touch the scene
+	 */
+	struct RenderItem
+	{
+		Vulkan::PipelineUserRef* pipeline	  = nullptr;
+		Vulkan::Buffer*			 vbo		  = nullptr;
+		uint32_t				 vertex_count = 0;
+
+		// Only used to order draws
+		glm::vec3 world_center{};
+		uint32_t  texture_key = 0;
+		uint8_t	  layer		  = 0;
+
+		RendererMatrixData matrix_data;
+	};
+
+	/**
+	 * Orders the draws of a frame by packed 64-bit keys
+	 *
+	 * World (perspective) items are drawn first, grouped by pipeline and texture
+	 * and front-to-back within a group. Screen (ortho) items are alpha blended and do not write
+	 * depth, so they are drawn after all world items by layer and back-to-front,
+	 * and only then grouped by pipeline. Their order alone decides which one ends up on top.
+	 *
+	 * Key layout in bits, most significant first:
+	 * - world:  pass (2), pipeline (16), texture (16), depth (30)
+	 * - screen: pass (2), layer (8), depth (24), pipeline (16), texture (14)
+	 */
+	class RenderQueue final
+	{
+	public:
+		struct Stats
+		{
+			size_t draws		  = 0;
+			size_t pipeline_binds = 0;
+		};
+
+		/**
+		 * Compute the key of an item
+		 *
+		 * @note The item must have a pipeline
+		 */
+		[[nodiscard]] static uint64_t
+		makeSortKey(const RenderItem& item, const FrameUniformData& frame_data);
+
+		/**
+		 * Order the items of a frame, items with nothing to draw are left out
+		 */
+		void sort(std::span<const RenderItem> items, const FrameUniformData& frame_data);
+
+		/**
+		 * Record the items in the order of the last @ref sort()
+		 *
+		 * Pipelines and vertex buffers are only bound when they differ from the previous draw.
+		 *
+		 * @param items          Items passed to the last @ref sort()
+		 * @param command_buffer Command buffer to record into
+		 * @param current_frame  Index of the frame in flight
+		 */
+		void record(
+			std::span<const RenderItem> items,
+			Vulkan::CommandBuffer*		command_buffer,
+			uint32_t					current_frame
+		) const;
+
+		/**
+		 * Get the number of draws and pipeline binds of the last @ref sort()
+		 */
+		[[nodiscard]] const Stats& getStats() const noexcept
+		{
+			return stats;
+		}
+
+	private:
+		struct Entry
+		{
+			uint64_t key;
+			uint32_t index;
+		};
+
+		std::vector<Entry> entries;
+
+		Stats stats;
+	};
+} // namespace Engine::Rendering
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Rendering/RenderQueue.hpp"
+#include "Rendering/Vulkan/common.hpp"
+
+#include <vector>
+
+namespace Engine::Rendering
+{
+	/**
+	 * Immutable state of a single frame as published to the render thread
+	 */
+	struct RenderSnapshot
+	{
+		FrameUniformData		frame_data;
+		std::vector<RenderItem> items;
+
+		// Draw order of items, sorted before the snapshot is published
+		RenderQueue queue;
+	};
+} // namespace Engine::Rendering
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Rendering/RenderSnapshot.hpp"
+#include "Rendering/Vulkan/exports.hpp"
+#include "Rendering/Vulkan/rendering.hpp"
+
+#include "Logging/Logging.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace Engine::Rendering
+{
+	/**
+	 * Records, submits and presents frames on a separate thread.
+	 *
+	 * The main thread fills the back snapshot and publishes it with @ref submit(),
+	 * the render thread then draws it while the main thread works on the next frame.
+	 *
+	 * @note Vulkan resources must only be created or destroyed by the main thread
+	 *       while the render thread is idle (see @ref waitIdle())
+	 */
+	class RenderThread final : public Logging::SupportsLogging
+	{
+	public:
+		RenderThread(
+			const Logging::SupportsLogging::logger_t& with_logger,
+			Vulkan::Window*							 with_window,
+			Vulkan::PipelineManager*				 with_pipeline_manager
+		);
+		~RenderThread();
+
+		RenderThread(const RenderThread&)			 = delete;
+		RenderThread(RenderThread&&)				 = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+		RenderThread& operator=(RenderThread&&)		 = delete;
+
+		/**
+		 * Get the snapshot that will be drawn on next @ref submit()
+		 *
+		 * @note Never read by the render thread, so it can be written while a frame is drawn
+		 */
+		[[nodiscard]] RenderSnapshot& getBackSnapshot()
+		{
+			return snapshots[1 - front_snapshot];
+		}
+
+		/**
+		 * Publish the back snapshot and start drawing it,
+		 * waits for the previous frame to finish first
+		 */
+		void submit();
+
+		/**
+		 * Wait until the render thread finishes drawing the current frame
+		 *
+		 * @throws Rethrows any exception that occured on the render thread
+		 */
+		void waitIdle();
+
+	private:
+		Vulkan::Window*			 window;
+		Vulkan::PipelineManager* pipeline_manager;
+
+		std::array<RenderSnapshot, 2> snapshots;
+		size_t						  front_snapshot = 0;
+
+		std::mutex				lock;
+		std::condition_variable state_changed;
+
+		bool frame_pending = false;
+		bool should_exit   = false;
+
+		std::exception_ptr render_exception;
+
+		std::thread thread;
+
+		void threadMain();
+
+		static void recordCallback(
+			Vulkan::CommandBuffer* command_buffer,
+			uint32_t			   current_frame,
+			void*				   render_thread
+		);
+	};
+} // namespace Engine::Rendering
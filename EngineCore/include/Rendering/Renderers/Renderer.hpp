@@ -2,11 +2,12 @@
 
 #include "Rendering/MeshBuilders/IMeshBuilder.hpp"
 #include "Rendering/MeshBuilders/MeshBuildContext.hpp"
+#include "Rendering/RenderQueue.hpp"
 #include "Rendering/SupplyData.hpp"
-#include "Rendering/Transform.hpp"
 #include "Rendering/Vulkan/exports.hpp"
 
 #include "InternalEngineObject.hpp"
+#include "glm/mat4x4.hpp"
 
 #include <cstdint>
 #include <memory>
@@ -30,27 +31,78 @@ namespace Engine::Rendering
 
 		void supplyData(const RendererSupplyData& data);
 
+		/**
+		 * Drop the texture set by supplied data, as if no data was supplied yet
+		 */
+		void clearSupplyData() noexcept
+		{
+			texture					= nullptr;
+			texture_key				= 0;
+			has_updated_descriptors = false;
+		}
+
 		// Renderers shall implement this to update their matrix_data
 		virtual void updateMatrices() = 0;
 
-		void updateTransform(const Transform& with_transform, const Transform& with_parent_transform)
+		/**
+		 * Which of the frame's view-projections this renderer draws with
+		 */
+		[[nodiscard]] virtual ProjectionType getProjectionType() const noexcept = 0;
+
+		/**
+		 * Mesh as last built, including its local-space bounds
+		 */
+		[[nodiscard]] const MeshBuildContext& getMeshContext() const
 		{
-			transform		 = with_transform;
-			parent_transform = with_parent_transform;
+			return mesh_builder->getContext();
+		}
+
+		/**
+		 * Set the model matrix, computed by the scene's transform hierarchy
+		 */
+		void updateWorldMatrix(const glm::mat4& with_world_matrix)
+		{
+			world_matrix = with_world_matrix;
 
 			has_updated_matrices = false;
 
 			/**
 			 * @todo Remove
 			 */
-			mesh_builder->supplyWorldPosition(with_transform.pos + with_parent_transform.pos);
+			mesh_builder->supplyWorldPosition(glm::vec3(with_world_matrix[3]));
 		}
 
-		void render(Vulkan::CommandBuffer* command_buffer, uint32_t current_frame);
+		/**
+		 * Whether @ref prepareRender() would create or update Vulkan resources
+		 */
+		[[nodiscard]] bool needsResourceUpdate() const noexcept
+		{
+			return !has_updated_descriptors || mesh_builder->needsRebuild();
+		}
+
+		/**
+		 * Bring matrices, descriptors and mesh up to date
+		 * and copy out the state required to draw this renderer
+		 *
+		 * @return Item to pass to @ref RenderQueue
+		 */
+		[[nodiscard]] RenderItem prepareRender();
+
+		/**
+		 * Set the layer of screen-space draws, higher layers are drawn over lower ones
+		 */
+		void setLayer(uint8_t with_layer) noexcept
+		{
+			layer = with_layer;
+		}
+
+		[[nodiscard]] uint8_t getLayer() const noexcept
+		{
+			return layer;
+		}
 
 	protected:
-		Transform transform;
-		Transform parent_transform;
+		glm::mat4 world_matrix = glm::mat4(1.0f);
 
 		// Renderer configuration
 		std::string_view pipeline_name;
@@ -64,12 +116,16 @@ namespace Engine::Rendering
 		std::shared_ptr<Rendering::Texture> texture = nullptr;
 		RendererMatrixData					matrix_data;
 
+		// Groups draws sharing a texture, derived from the texture asset
+		uint32_t texture_key = 0;
+		uint8_t	 layer		 = 0;
+
 		// When false, UpdateDescriptorSets shall be internally called on next Render
 		bool has_updated_descriptors = false;
 		void updateDescriptorSets();
 
 		// When false, UpdateMatrices will be called
-		// Note that UpdateMatrices is also manually called from SceneManager
+		// (view and projection are per-frame data, only the model matrix is kept here)
 		bool has_updated_matrices = false;
 
 	private:
@@ -82,6 +138,11 @@ namespace Engine::Rendering
 		using IRenderer::IRenderer;
 
 		void updateMatrices() override;
+
+		[[nodiscard]] ProjectionType getProjectionType() const noexcept override
+		{
+			return ProjectionType::perspective;
+		}
 	};
 
 	class Renderer2D final : public IRenderer
@@ -90,5 +151,10 @@ namespace Engine::Rendering
 		using IRenderer::IRenderer;
 
 		void updateMatrices() override;
+
+		[[nodiscard]] ProjectionType getProjectionType() const noexcept override
+		{
+			return ProjectionType::ortho;
+		}
 	};
 } // namespace Engine::Rendering
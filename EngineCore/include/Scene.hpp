@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Assets/AssetManager.hpp"
+#include "Rendering/MeshBuilders/IMeshBuilder.hpp"
 
 #include "Scripting/ILuaScript.hpp"
 
@@ -8,12 +9,18 @@
 
 #include "EventHandling.hpp"
 #include "InternalEngineObject.hpp"
+#include "MemoryUsage.hpp"
+#include "ObjectStorage.hpp"
 #include "SceneObject.hpp"
+#include "SpatialIndex.hpp"
+#include "glm/vec3.hpp"
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Engine
 {
@@ -27,20 +34,133 @@ namespace Engine
 		Scene(Engine* with_engine);
 		~Scene();
 
-		[[nodiscard]] const std::unordered_map<std::string, SceneObject*>& getAllObjects() noexcept;
+		/**
+		 * Get the dense storage of all objects in this scene
+		 */
+		[[nodiscard]] const ObjectStorage& getObjects() const noexcept
+		{
+			return objects;
+		}
+
+		/**
+		 * Add an object to the scene, the scene takes ownership of it
+		 *
+		 * @throws Engine exception if an object with the same name exists
+		 */
+		ObjectHandle addObject(const std::string& name, SceneObject* ptr);
+
+		/**
+		 * Add an instance of a template, reusing a previously removed instance if possible
+		 *
+		 * Instances of templates with a shareable mesh draw the template's vertex buffer,
+		 * only their uniform buffers and descriptors are per-instance.
+		 *
+		 * @throws Engine exception if the template does not exist
+		 */
+		ObjectHandle addTemplatedObject(const std::string& name, const std::string& template_name);
 
-		void addObject(const std::string& name, SceneObject* ptr);
-		void addTemplatedObject(const std::string& name, const std::string& template_name);
 		[[nodiscard]] SceneObject* findObject(const std::string& name);
-		void					   removeObject(const std::string& name);
+		[[nodiscard]] ObjectHandle findHandle(const std::string& name) const noexcept;
+
+		/**
+		 * @return The object or nullptr if it was removed
+		 */
+		[[nodiscard]] SceneObject* getObject(ObjectHandle handle) const noexcept;
+
+		/**
+		 * Remove an object from the scene
+		 *
+		 * The object is unlinked immediately but only destroyed once no frame in flight draws it,
+		 * instances of templates with a shareable mesh are kept for reuse instead.
+		 *
+		 * @throws Engine exception if no object with the name exists
+		 */
+		void removeObject(const std::string& name);
+
+		/**
+		 * Recompute world matrices and bounds of objects that moved (and their descendants)
+		 *
+		 * Called once per frame before rendering, changing a transform only marks it dirty.
+		 *
+		 * @return Number of recomputed world matrices
+		 */
+		size_t updateTransforms();
+
+		/*
+		 * Spatial queries, run @ref updateTransforms() first so that objects moved
+		 * and meshes rebuilt since the last frame are found where they are now
+		 */
+
+		[[nodiscard]] std::vector<ObjectHandle>
+		queryRadius(SpatialIndex::Space space, const glm::vec3& center, float radius);
+
+		[[nodiscard]] std::vector<ObjectHandle>
+		queryAABB(SpatialIndex::Space space, const glm::vec3& min, const glm::vec3& max);
+
+		/**
+		 * @return Objects hit by the ray, nearest first
+		 */
+		[[nodiscard]] std::vector<ObjectHandle> queryRay(
+			SpatialIndex::Space space,
+			const glm::vec3&	origin,
+			const glm::vec3&	direction,
+			float				max_distance
+		);
 
 		void loadTemplatedObject(
 			const std::string&								name,
 			const Factories::ObjectFactory::ObjectTemplate& object
 		);
 
+		/**
+		 * Estimate the memory held by the scene's assets, scripts and objects
+		 *
+		 * @note Walks all assets and objects, not meant to be called every frame
+		 */
+		[[nodiscard]] MemoryUsage getMemoryUsage();
+
+		/**
+		 * Get the builders of template meshes that have not been uploaded yet
+		 */
+		[[nodiscard]] std::vector<Rendering::IMeshBuilder*> getPendingTemplateMeshes() const;
+
 	private:
-		std::unordered_map<std::string, SceneObject*>							  objects;
-		std::unordered_map<std::string, Factories::ObjectFactory::ObjectTemplate> templates;
+		struct TemplateState
+		{
+			Factories::ObjectFactory::ObjectTemplate object_template;
+
+			// Builds the mesh shared by all instances, nullptr if instances build their own
+			std::unique_ptr<Rendering::IMeshBuilder> mesh_prototype;
+
+			// Removed instances, kept with their renderer and pipeline resources
+			std::vector<SceneObject*> free_instances;
+		};
+
+		// Further removed instances of a template are destroyed
+		static constexpr size_t max_free_instances = 64;
+
+		ObjectStorage objects;
+
+		std::unordered_map<std::string, TemplateState> templates;
+
+		// Template of every instance that may be reused
+		std::unordered_map<const SceneObject*, TemplateState*> template_instances;
+
+		/**
+		 * Get an unused instance of a template, either from its pool or a new one
+		 */
+		[[nodiscard]] SceneObject* acquireInstance(TemplateState& from_template);
+
+		/**
+		 * Return an object that is no longer in the scene to its template's pool
+		 *
+		 * @return Whether the object was pooled, otherwise the caller has to destroy it
+		 */
+		bool recycleInstance(SceneObject* object);
+
+		/**
+		 * Restore the transform, layer and supplied data of an instance to its template's
+		 */
+		static void resetInstance(SceneObject* object, const TemplateState& from_template);
 	};
 } // namespace Engine
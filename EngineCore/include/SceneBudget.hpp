@@ -0,0 +1,37 @@
+#pragma once
+
+#include "MemoryUsage.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+	/**
+	 * A resident scene as seen by the memory budget
+	 */
+	struct SceneBudgetEntry
+	{
+		std::string name;
+		MemoryUsage usage;
+		uint64_t	last_used = 0;
+
+		// Current, pinned and not yet switched to scenes are never unloaded
+		bool is_unloadable = false;
+	};
+
+	/**
+	 * @return True if @p usage exceeds @p budget, a budget of 0 is unlimited
+	 */
+	[[nodiscard]] bool isOverBudget(const MemoryUsage& usage, const MemoryUsage& budget);
+
+	/**
+	 * Pick scenes to unload until the rest fits in @p budget
+	 *
+	 * @return Unloadable scenes, least recently used first. The remaining scenes may
+	 *         still exceed the budget if not enough of them can be unloaded.
+	 */
+	[[nodiscard]] std::vector<SceneBudgetEntry>
+	selectScenesToUnload(std::vector<SceneBudgetEntry> scenes, const MemoryUsage& budget);
+} // namespace Engine
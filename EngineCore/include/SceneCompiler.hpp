@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+#ifndef JSON_USE_IMPLICIT_CONVERSIONS
+#	define JSON_USE_IMPLICIT_CONVERSIONS 0
+#endif
+#include "nlohmann/json.hpp"
+
+namespace Engine::SceneCompiler
+{
+	/**
+	 * Compile the contents of a scene.json
+	 *
+	 * All enums are resolved here, so unknown names fail compilation instead of loading.
+	 *
+	 * @return Contents of the compiled file, laid out as described in @ref SceneFormat
+	 */
+	[[nodiscard]] std::vector<std::byte> compile(const nlohmann::json& data);
+
+	/**
+	 * Parse and compile the scene.json of a scene directory
+	 */
+	[[nodiscard]] std::vector<std::byte> compileDirectory(const std::filesystem::path& scene_path);
+} // namespace Engine::SceneCompiler
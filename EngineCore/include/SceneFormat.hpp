@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Layout of compiled scene files
+ *
+ * A compiled scene holds the same data as a scene.json with every enum already resolved.
+ * Records are fixed-size and refer to strings by their position in a single string table,
+ * so the file can be read in place once it is mapped into memory.
+ *
+ * @note Values are stored in the byte order of the machine that compiled the scene
+ */
+namespace Engine::SceneFormat
+{
+	constexpr std::array<char, 4> magic	  = {'C', 'M', 'S', 'C'};
+	constexpr uint32_t			  version = 1;
+
+	// Compiled scenes are placed next to the scene.json they were compiled from
+	constexpr const char* compiled_file_name = "scene.bin";
+	constexpr const char* source_file_name	 = "scene.json";
+
+	// Records are aligned to this, so that they can be read in place
+	constexpr uint32_t record_alignment = 4;
+
+	/**
+	 * Range of bytes in the string table, strings are not null-terminated
+	 */
+	struct StringRef
+	{
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	/**
+	 * Range of records, @ref offset is relative to the start of the file
+	 */
+	struct Section
+	{
+		uint32_t offset;
+		uint32_t count;
+	};
+
+	struct Header
+	{
+		std::array<char, 4> magic;
+		uint32_t			version;
+
+		// Offset relative to the start of the file, size in bytes
+		uint32_t string_table_offset;
+		uint32_t string_table_size;
+
+		Section assets;
+		Section event_handlers;
+		Section templates;
+		Section supply_data;
+	};
+
+	struct AssetRecord
+	{
+		StringRef name;
+		StringRef location;
+
+		// AssetType
+		uint8_t type;
+		uint8_t is_generator;
+		uint8_t padding[2];
+
+		// vk::Filter and vk::SamplerAddressMode, only used by textures
+		uint32_t filtering;
+		uint32_t sampling_mode;
+	};
+
+	struct EventHandlerRecord
+	{
+		// EventHandling::EventType
+		uint32_t  event_type;
+		StringRef script;
+		StringRef function;
+	};
+
+	/**
+	 * Supply data of a template, as RendererSupplyData::Type or MeshBuilderSupplyData::Type
+	 */
+	struct SupplyRecord
+	{
+		uint32_t  type;
+		StringRef value;
+	};
+
+	struct TemplateRecord
+	{
+		StringRef name;
+		StringRef shader;
+
+		// ObjectFactory::RendererType and ObjectFactory::MeshBuilderType
+		uint8_t renderer;
+		uint8_t mesh_builder;
+		uint8_t padding[2];
+
+		// Ranges of the supply_data section, offset is the index of the first record
+		Section renderer_supply;
+		Section meshbuilder_supply;
+	};
+
+	template <typename record_t>
+	concept Record = std::is_trivially_copyable_v<record_t> &&
+					 std::is_standard_layout_v<record_t> &&
+					 alignof(record_t) <= record_alignment;
+
+	static_assert(Record<Header>);
+	static_assert(Record<AssetRecord>);
+	static_assert(Record<EventHandlerRecord>);
+	static_assert(Record<SupplyRecord>);
+	static_assert(Record<TemplateRecord>);
+} // namespace Engine::SceneFormat
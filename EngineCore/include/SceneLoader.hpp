@@ -1,16 +1,22 @@
 #pragma once
 
+#include "Factories/TextureFactory.hpp"
+#include "Scripting/ILuaScript.hpp"
+
+#include "CompiledScene.hpp"
 #include "InternalEngineObject.hpp"
+#include "JobSystem.hpp"
 #include "Scene.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <filesystem>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
-
-#ifndef JSON_USE_IMPLICIT_CONVERSIONS
-#	define JSON_USE_IMPLICIT_CONVERSIONS 0
-#endif
-#include "nlohmann/json.hpp"
+#include <vector>
 
 namespace Engine
 {
@@ -22,18 +28,112 @@ namespace Engine
 		using InternalEngineObject::InternalEngineObject;
 		~SceneLoader();
 
+		/**
+		 * Start loading the parts of a scene that don't need the GPU on the job system
+		 *
+		 * Reads the scene file, decodes textures and compiles scripts. A later
+		 * @ref loadScene or @ref stepLoad of the same scene uses its results.
+		 */
+		void prefetchScene(const std::string& name, Base::JobSystem& job_system);
+
+		/**
+		 * Load a scene, waiting for its prefetch if there is one
+		 */
 		std::shared_ptr<Scene> loadScene(const std::string& name);
 
+		/**
+		 * Continue loading a prefetched scene without waiting for the job system
+		 *
+		 * Assets that need the GPU are created until @p budget is used up,
+		 * so a scene may take several calls to complete.
+		 *
+		 * @note Has to be called while no frame is being drawn
+		 *
+		 * @return The scene once it is completely loaded, nullptr otherwise
+		 */
+		std::shared_ptr<Scene> stepLoad(const std::string& name, std::chrono::nanoseconds budget);
+
+		/**
+		 * Get how far a prefetched scene is from being loaded
+		 *
+		 * @return Value from 0 to 1, 1 if the scene is not being loaded
+		 */
+		[[nodiscard]] float getLoadProgress(const std::string& name) const;
+
+		/**
+		 * Results of preparing a single asset off the engine thread
+		 */
+		struct PrefetchedAsset
+		{
+			std::optional<Factories::TextureFactory::DecodedImage> image;
+			std::shared_ptr<Scripting::ILuaScript>				   script;
+		};
+
 	protected:
-		void loadSceneAssets(
-			const nlohmann::json&		 data,
+		struct Prefetch
+		{
+			// Mapped scene.bin, or scene.json compiled on load
+			std::unique_ptr<CompiledScene> data;
+
+			// Indexed the same as the scene's assets
+			std::vector<PrefetchedAsset> assets;
+
+			// Reads the scene file and schedules decode_job
+			Base::JobHandle job;
+			Base::JobHandle decode_job;
+
+			std::atomic<size_t> asset_count	  = 0;
+			std::atomic<size_t> decoded_count = 0;
+
+			// Filled in by the engine thread once decoding has finished
+			std::shared_ptr<Scene> scene;
+			size_t				   loaded_count = 0;
+
+			[[nodiscard]] bool isDone() const noexcept
+			{
+				// decode_job is only valid once job has finished
+				return job.isDone() && decode_job.isDone();
+			}
+		};
+
+		std::map<std::string, std::unique_ptr<Prefetch>> prefetches;
+
+		/**
+		 * Open the compiled scene if it is up to date, compile the scene.json otherwise
+		 *
+		 * Compiled scenes of another format version count as outdated if the scene.json exists.
+		 */
+		[[nodiscard]] std::unique_ptr<CompiledScene>
+		openSceneFile(const std::filesystem::path& scene_path) const;
+
+		/**
+		 * Load assets of a scene until all are loaded or @p budget is used up
+		 *
+		 * @return Whether all assets are loaded
+		 */
+		bool loadSceneAssets(
+			Prefetch&					 prefetch,
 			const std::filesystem::path& scene_path,
-			std::shared_ptr<Scene>&		 scene
+			std::chrono::nanoseconds	 budget
 		);
 
-		void loadSceneTemplates(const nlohmann::json& data, std::shared_ptr<Scene>& scene);
-		void loadSceneEventHandlers(const nlohmann::json& data, std::shared_ptr<Scene>& scene);
+		void loadSceneTemplates(const CompiledScene& scene_data, std::shared_ptr<Scene>& scene);
+		void loadSceneEventHandlers(const CompiledScene& scene_data, std::shared_ptr<Scene>& scene);
+
+		/**
+		 * Load whatever is left of a scene whose prefetch has finished
+		 *
+		 * @return Whether the scene is completely loaded
+		 */
+		bool loadSceneInternal(
+			Prefetch&				 prefetch,
+			const std::string&		 scene_name,
+			std::chrono::nanoseconds budget
+		);
 
-		void loadSceneInternal(std::shared_ptr<Scene>& scene, const std::string& scene_name);
+		/**
+		 * Rethrow exceptions of a finished prefetch
+		 */
+		void checkPrefetch(const Prefetch& prefetch);
 	};
 } // namespace Engine
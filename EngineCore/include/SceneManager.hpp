@@ -1,11 +1,19 @@
 #pragma once
 
+#include "Rendering/Vulkan/common.hpp"
+
 #include "InternalEngineObject.hpp"
+#include "MemoryUsage.hpp"
 #include "Scene.hpp"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace Engine
 {
@@ -19,11 +27,83 @@ namespace Engine
 		SceneManager(Engine* with_engine);
 		~SceneManager();
 
-		void				   setSceneLoadPrefix(const std::string& scene_prefix);
-		void				   loadScene(const std::string& scene_name);
+		void setSceneLoadPrefix(const std::string& scene_prefix);
+
+		/**
+		 * Start decoding and compiling a scene's assets on the job system
+		 *
+		 * Doesn't need the Vulkan instance, so it can overlap with its creation.
+		 * The scene is completed by the next @ref loadScene or @ref setScene.
+		 */
+		void prefetchScene(const std::string& scene_name);
+
+		/**
+		 * Start loading a scene in the background while the current scene keeps running
+		 *
+		 * Decoding and script compilation run on the job system, GPU resources are created
+		 * a few at a time by @ref update. The current scene receives an onSceneLoaded event
+		 * once the scene is resident.
+		 */
+		void preloadScene(const std::string& scene_name);
+
+		/**
+		 * Load a scene, blocking until it is resident
+		 */
+		void loadScene(const std::string& scene_name);
+
+		/**
+		 * Switch to a scene, right away if it's resident
+		 *
+		 * Otherwise the scene is preloaded and switched to once it is resident,
+		 * the current scene keeps running until then.
+		 */
 		void				   setScene(const std::string& scene_name);
 		std::shared_ptr<Scene> getSceneCurrent();
 
+		/**
+		 * Continue preloading scenes, and switch scenes that became resident
+		 *
+		 * @note Has to be called while no frame is being drawn
+		 */
+		void update();
+
+		/**
+		 * @return Value from 0 to 1, 1 if the scene is resident
+		 */
+		[[nodiscard]] float getLoadProgress(const std::string& scene_name) const;
+
+		/**
+		 * Limit the memory of resident scenes
+		 *
+		 * Once a budget is exceeded, inactive scenes that aren't pinned are unloaded
+		 * least recently used first. Scenes that are loaded or preloaded but weren't
+		 * switched to yet are kept, the budget is checked again after each switch.
+		 *
+		 * @param cpu_bytes,gpu_bytes Budgets in bytes, 0 for unlimited
+		 */
+		void setMemoryBudget(size_t cpu_bytes, size_t gpu_bytes);
+
+		/**
+		 * Keep a scene resident regardless of the memory budget
+		 */
+		void pinScene(const std::string& scene_name);
+		void unpinScene(const std::string& scene_name);
+
+		struct SceneMemoryReport
+		{
+			std::string name;
+			MemoryUsage usage;
+			bool		is_current;
+			bool		is_pinned;
+		};
+
+		/**
+		 * Estimate the memory of every resident scene
+		 *
+		 * @note Walks all assets and objects, not meant to be called every frame
+		 */
+		[[nodiscard]] std::vector<SceneMemoryReport> getMemoryReport() const;
+
 		/**
 		 * @todo Remove?
 		 */
@@ -32,11 +112,17 @@ namespace Engine
 
 		glm::vec3 getCameraTransform();
 		glm::vec2 getCameraRotation();
-		glm::mat4 getCameraViewMatrix();
 
+		[[nodiscard]] glm::mat4		   getCameraViewMatrix() const;
 		[[nodiscard]] glm::mat4		   getProjectionMatrix() const;
 		[[nodiscard]] static glm::mat4 getProjectionMatrixOrtho();
 
+		/**
+		 * Compute the view-projection matrices shared by all objects,
+		 * called once per frame so that camera changes don't touch any object
+		 */
+		[[nodiscard]] Rendering::FrameUniformData getFrameUniformData() const;
+
 		void setCameraTransform(glm::vec3 transform);
 		void setCameraRotation(glm::vec2 hvrotation);
 
@@ -46,6 +132,33 @@ namespace Engine
 		std::unordered_map<std::string, scene_t> scenes;
 		scene_t									 current_scene;
 
+		// Scenes being preloaded, in order of request
+		std::vector<std::string> preloading;
+
+		// Scene that setScene was called for before it was resident
+		std::string pending_scene;
+
+		// Resident scenes that weren't switched to yet, kept regardless of the budget
+		std::unordered_set<std::string> awaiting_activation;
+
+		// Time spent creating GPU resources of preloading scenes per frame
+		static constexpr std::chrono::milliseconds load_step_budget{2};
+
+		// Scenes are unloaded in order of the last time they became current or resident
+		std::unordered_map<std::string, uint64_t> last_used;
+		uint64_t								  use_counter = 0;
+
+		std::unordered_set<std::string> pinned_scenes;
+
+		MemoryUsage memory_budget;
+
+		void markUsed(const std::string& scene_name);
+
+		/**
+		 * Unload inactive scenes until resident scenes fit the memory budget
+		 */
+		void enforceMemoryBudget();
+
 		glm::vec3 camera_transform	 = {}; // XYZ position
 		glm::vec2 camera_hv_rotation = {}; // Horizontal and Vertical rotation
 
@@ -57,7 +170,5 @@ namespace Engine
 		glm::vec3 light_position{};
 
 		std::unique_ptr<SceneLoader> scene_loader;
-
-		void onCameraUpdated();
 	};
 } // namespace Engine
@@ -5,6 +5,7 @@
 #include "Rendering/Transform.hpp"
 
 #include "InternalEngineObject.hpp"
+#include "ObjectStorage.hpp"
 
 #include <vector>
 
@@ -31,6 +32,15 @@ namespace Engine
 		[[nodiscard]] glm::vec3 getSize() const noexcept;
 		[[nodiscard]] glm::vec3 getRotation() const noexcept;
 
+		/**
+		 * Set the layer of a screen-space object, higher layers are drawn over lower ones
+		 *
+		 * @param with_layer Layer between 0 and 255, values outside are clamped
+		 */
+		void setLayer(int with_layer);
+
+		[[nodiscard]] int getLayer() const noexcept;
+
 		[[nodiscard]] Rendering::IRenderer* getRenderer()
 		{
 			return renderer;
@@ -40,16 +50,36 @@ namespace Engine
 			return mesh_builder;
 		}
 
+		/*
+		 * Transforms are relative to the parent, hierarchies may be of any depth
+		 */
+
 		void addChild(SceneObject* with_child);
 		void removeChildren();
+
+		/**
+		 * Move the object under a new parent (or make it a root if nullptr)
+		 *
+		 * @throws Engine exception if this would create a cycle
+		 */
 		void setParent(SceneObject* with_parent);
 
-		void setParentTransform(const Rendering::Transform& with_parent_transform);
+		/**
+		 * @return Handle of the object in its scene, invalid if not added to one
+		 */
+		[[nodiscard]] ObjectHandle getHandle() const noexcept
+		{
+			return handle;
+		}
 
 	private:
-		// Initialize parent transform so that the object renders without parent properly
-		Rendering::Transform parent_transform = {glm::vec3(0), glm::vec3(1, 1, 1), glm::vec3(0)};
-		Rendering::Transform transform		  = {};
+		friend class ObjectStorage;
+
+		// Only used until the object is added to a scene, the scene's storage holds it afterwards
+		Rendering::Transform transform = {};
+
+		ObjectStorage* storage = nullptr;
+		ObjectHandle   handle;
 
 		SceneObject*			  parent = nullptr;
 		std::vector<SceneObject*> children;
@@ -57,6 +87,11 @@ namespace Engine
 		Rendering::IRenderer*	 renderer	  = nullptr;
 		Rendering::IMeshBuilder* mesh_builder = nullptr;
 
-		void updateRenderer();
+		[[nodiscard]] Rendering::Transform getTransform() const;
+
+		/**
+		 * Schedule the world matrix of this object and its descendants to be recomputed
+		 */
+		void markTransformDirty();
 	};
 } // namespace Engine
@@ -3,6 +3,7 @@
 #include "Assets/AssetManager.hpp"
 
 #include "EventHandling.hpp"
+#include "ObjectStorage.hpp"
 #include "Scene.hpp"
 #include "SceneManager.hpp"
 #include "SceneObject.hpp"
@@ -26,4 +27,15 @@ namespace Engine::Scripting::API::LuaFactories
 	template <>
 	void templatedFactory(lua_State* state, Engine* object_ptr);
 
+	/**
+	 * Construct a table for an object of @p scene, referencing it by @p handle
+	 */
+	void sceneObjectFactory(lua_State* state, Scene* scene, ObjectHandle handle);
+
+	/**
+	 * Make the object table at @p index reference its object by handle
+	 * once the object was added to @p scene
+	 */
+	void attachObjectHandle(lua_State* state, int index, Scene* scene, ObjectHandle handle);
+
 } // namespace Engine::Scripting::API::LuaFactories
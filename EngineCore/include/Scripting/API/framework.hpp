@@ -5,6 +5,11 @@
 #include "Exception.hpp"
 #include "lua.hpp"
 
+namespace Engine
+{
+	class SceneObject;
+}
+
 namespace Engine::Scripting
 {
 	template <typename class_t>
@@ -16,6 +21,14 @@ namespace Engine::Scripting
 
 		return val_ptr;
 	}
+
+	/**
+	 * Objects added to a scene are referenced by handle, resolve it through their scene
+	 *
+	 * @throws Engine exception if the object was removed from the scene
+	 */
+	template <>
+	SceneObject* getObjectAsPointer<SceneObject>(lua_State* state, int index);
 } // namespace Engine::Scripting
 // NOLINTBEGIN(*unused-macros)
 /**
@@ -2,6 +2,9 @@
 
 #include "Scripting/ILuaScript.hpp"
 
+#include "EventHandling.hpp"
+
+#include <span>
 #include <string>
 
 namespace Engine::Scripting
@@ -14,6 +17,11 @@ namespace Engine::Scripting
 	private:
 		void initializeCall(const std::string& function);
 
+		/**
+		 * Push an array of tables describing @p inputs onto the stack
+		 */
+		void pushInputs(std::span<const EventHandling::InputEvent> inputs);
+
 		int internalCall(const std::string& function, void* data) override;
 	};
 } // namespace Engine::Scripting
@@ -64,6 +64,9 @@ namespace Engine::Scripting
 		std::weak_ptr<ILuaScript> script;
 		std::string				  function;
 
+		// Name shown in traces, interned once so that calls don't have to
+		const char* zone_name = "Lua function";
+
 		int operator()(void* data);
 	};
 } // namespace Engine::Scripting
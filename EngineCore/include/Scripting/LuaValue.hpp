@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -62,6 +63,13 @@ namespace Engine::Scripting
 		LuaValue(string_t val) : type(Type::STRING), value(val) {}
 		/** Construct a LuaValue object as if containing a Lua `number` value. */
 		LuaValue(number_t val) : type(Type::NUMBER), value(val) {}
+		/**
+		 * Construct a LuaValue object as if containing a Lua `boolean` value.
+		 * Only takes an exact bool, so integers and string literals still convert as before.
+		 */
+		template <typename bool_t>
+			requires(std::is_same_v<bool_t, bool>)
+		LuaValue(bool_t val) : type(Type::BOOL), value(val) {}
 
 		/**
 		 * Construct a LuaValue object from an actual Lua value on the stack.
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Rendering/Bounds.hpp"
+
+#include "ObjectHandle.hpp"
+#include "glm/vec3.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+	/**
+	 * Broad-phase index of object bounds for spatial queries
+	 *
+	 * Every space is a hashed uniform grid, an object is listed in every cell its bounds touch.
+	 * Objects touching too many cells (terrain, backgrounds) are kept in a separate list
+	 * that every query tests directly.
+	 *
+	 * @note Entries are addressed by the slot index of their handle
+	 */
+	class SpatialIndex final
+	{
+	public:
+		/**
+		 * Coordinate space of an object, objects are only found by queries in the same space
+		 */
+		enum class Space : uint8_t
+		{
+			world  = 0, // Perspective objects
+			screen = 1	// Orthographic (2D) objects
+		};
+
+		/**
+		 * Insert an object or move it to new bounds
+		 */
+		void update(ObjectHandle handle, Space space, const Rendering::AABB& bounds);
+
+		void remove(ObjectHandle handle);
+
+		/**
+		 * Find objects whose bounds overlap a box
+		 */
+		void queryAABB(Space space, const Rendering::AABB& box, std::vector<ObjectHandle>& out)
+			const;
+
+		/**
+		 * Find objects whose bounds overlap a sphere
+		 */
+		void queryRadius(
+			Space					   space,
+			const glm::vec3&		   center,
+			float					   radius,
+			std::vector<ObjectHandle>& out
+		) const;
+
+		/**
+		 * Find objects whose bounds are hit by a ray, ordered by distance of the hit
+		 *
+		 * @param direction    Direction of the ray, need not be normalized
+		 * @param max_distance Length of the ray in multiples of @p direction
+		 */
+		void queryRay(
+			Space					   space,
+			const glm::vec3&		   origin,
+			const glm::vec3&		   direction,
+			float					   max_distance,
+			std::vector<ObjectHandle>& out
+		) const;
+
+	private:
+		using CellCoord = std::array<int32_t, 3>;
+
+		struct Entry
+		{
+			ObjectHandle	handle;
+			Rendering::AABB bounds;
+			CellCoord		cell_min;
+			CellCoord		cell_max;
+			Space			space;
+			bool			present	  = false;
+			bool			oversized = false;
+
+			// Last query that visited this entry, so objects in several cells are reported once
+			mutable uint32_t query_stamp = 0;
+		};
+
+		struct Grid
+		{
+			float cell_size;
+
+			std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+			std::vector<uint32_t>								oversized;
+		};
+
+		// Objects spanning more cells than this are not bucketed
+		static constexpr size_t max_cells_per_object = 64;
+
+		std::vector<Entry> entries;
+
+		// Indexed by Space, cell sizes are tuned for voxel chunks and the [-1, 1] screen
+		std::array<Grid, 2> grids = {Grid{.cell_size = 16.0f}, Grid{.cell_size = 0.125f}};
+
+		mutable uint32_t current_stamp = 0;
+
+		[[nodiscard]] static uint64_t packCell(int32_t x, int32_t y, int32_t z) noexcept;
+
+		[[nodiscard]] static CellCoord toCell(const Grid& grid, const glm::vec3& point) noexcept;
+
+		void link(uint32_t entry_index);
+		void unlink(uint32_t entry_index);
+
+		/**
+		 * Start a new query
+		 *
+		 * @return Stamp to mark visited entries with
+		 */
+		uint32_t nextStamp() const;
+
+		/**
+		 * Collect entries of a box of cells (and all oversized entries) that overlap @p box
+		 */
+		void gatherOverlapping(Space space, const Rendering::AABB& box, std::vector<uint32_t>& out)
+			const;
+	};
+} // namespace Engine
@@ -7,6 +7,7 @@
 
 #include "Exception.hpp"
 #include "InternalEngineObject.hpp"
+#include "MemoryUsage.hpp"
 
 #include <cassert>
 #include <memory>
@@ -73,5 +74,17 @@ namespace Engine::Rendering
 		return {};
 	}
 
+	MemoryUsage Font::getMemoryUsage() const
+	{
+		MemoryUsage usage = {.cpu_bytes = data->chars.size() * sizeof(FontChar), .gpu_bytes = 0};
+
+		for (const auto& [index, page] : data->pages)
+		{
+			if (page) { usage += page->getMemoryUsage(); }
+		}
+
+		return usage;
+	}
+
 #pragma endregion
 } // namespace Engine::Rendering
@@ -1,11 +1,16 @@
 #include "Assets/Texture.hpp"
 
+#include "Rendering/Vulkan/backend.hpp"
+#include "Rendering/Vulkan/exports.hpp"
+
 #include "Logging/Logging.hpp"
 
 #include "Engine.hpp"
 #include "InternalEngineObject.hpp"
+#include "MemoryUsage.hpp"
 
 #include <cassert>
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -20,10 +25,23 @@ namespace Engine::Rendering
 	{
 		this->logger->logSingle<decltype(this)>(Logging::LogLevel::VerboseDebug, "Destructor called");
 
-		delete this->data->image;
-		delete this->data->sampler;
+		// Frames in flight may still sample the image
+		auto* deletion_queue = owner_engine->getVulkanInstance()->getDeletionQueue();
+		deletion_queue->retire(this->data->image);
+		deletion_queue->retire(this->data->sampler);
 
 		this->data.reset();
 	}
 
+	MemoryUsage Texture::getMemoryUsage() const
+	{
+		// Images are always created as 4 channels of 8 bits
+		constexpr size_t image_channels = 4;
+
+		return {
+			.cpu_bytes = data->data.size(),
+			.gpu_bytes = static_cast<size_t>(data->size.x) * data->size.y * image_channels
+		};
+	}
+
 } // namespace Engine::Rendering
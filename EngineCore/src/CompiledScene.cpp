@@ -0,0 +1,314 @@
+#include "CompiledScene.hpp"
+
+#include "Exception.hpp"
+#include "PlatformSemantics.hpp"
+#include "SceneFormat.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <initializer_list>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(SEMANTICS_MSVC)
+#	define CMEP_SCENE_MAPPING
+#	define WIN32_LEAN_AND_MEAN
+#	include <windows.h>
+#elif defined(SEMANTICS_UNIXLIKE) && !defined(_WIN32)
+#	define CMEP_SCENE_MAPPING
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace Engine
+{
+#pragma region Internal static
+
+	namespace
+	{
+		[[nodiscard]] bool isInRange(uint64_t offset, uint64_t size, uint64_t limit) noexcept
+		{
+			return offset <= limit && size <= limit - offset;
+		}
+
+#ifdef CMEP_SCENE_MAPPING
+		/**
+		 * Map a whole file read-only
+		 *
+		 * @return Address and size of the mapping
+		 */
+		std::pair<void*, size_t> mapFile(const std::filesystem::path& file_path)
+		{
+#	if defined(SEMANTICS_MSVC)
+			HANDLE file = CreateFileW(
+				file_path.c_str(),
+				GENERIC_READ,
+				FILE_SHARE_READ,
+				nullptr,
+				OPEN_EXISTING,
+				FILE_ATTRIBUTE_NORMAL,
+				nullptr
+			);
+			EXCEPTION_ASSERT(file != INVALID_HANDLE_VALUE, "Could not open file!");
+
+			LARGE_INTEGER file_size{};
+			if (GetFileSizeEx(file, &file_size) == 0 || file_size.QuadPart <= 0)
+			{
+				CloseHandle(file);
+				throw ENGINE_EXCEPTION("Could not get size of file or file is empty!");
+			}
+
+			// The view keeps the mapping alive, neither handle is needed past this point
+			HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			CloseHandle(file);
+			EXCEPTION_ASSERT(mapping != nullptr, "Could not create file mapping!");
+
+			void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+			EXCEPTION_ASSERT(address != nullptr, "Could not map view of file!");
+
+			return {address, static_cast<size_t>(file_size.QuadPart)};
+#	else
+			const int file = open(file_path.c_str(), O_RDONLY);
+			EXCEPTION_ASSERT(file >= 0, "Could not open file!");
+
+			struct stat status{};
+			if (fstat(file, &status) != 0 || status.st_size <= 0)
+			{
+				close(file);
+				throw ENGINE_EXCEPTION("Could not get size of file or file is empty!");
+			}
+
+			const auto file_size = static_cast<size_t>(status.st_size);
+
+			// The mapping stays valid after the descriptor is closed
+			void* address = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file, 0);
+			close(file);
+			EXCEPTION_ASSERT(address != MAP_FAILED, "Could not map file!");
+
+			return {address, file_size};
+#	endif
+		}
+
+		void unmapFile(void* address, size_t size) noexcept
+		{
+#	if defined(SEMANTICS_MSVC)
+			(void)size;
+			UnmapViewOfFile(address);
+#	else
+			munmap(address, size);
+#	endif
+		}
+#else
+		std::vector<std::byte> readFile(const std::filesystem::path& file_path)
+		{
+			std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+			EXCEPTION_ASSERT(file.is_open(), "Could not open file!");
+
+			std::vector<std::byte> data(static_cast<size_t>(file.tellg()));
+
+			file.seekg(0);
+			file.read(
+				reinterpret_cast<char*>(data.data()),
+				static_cast<std::streamsize>(data.size())
+			);
+
+			return data;
+		}
+#endif
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+	CompiledScene::CompiledScene(const std::filesystem::path& file_path)
+	{
+		try
+		{
+#ifdef CMEP_SCENE_MAPPING
+			std::tie(mapping, mapping_size) = mapFile(file_path);
+			bytes = {static_cast<const std::byte*>(mapping), mapping_size};
+#else
+			owned_bytes = readFile(file_path);
+			bytes		= owned_bytes;
+#endif
+
+			validate();
+		}
+		catch (...)
+		{
+			// The destructor does not run for a throwing constructor
+#ifdef CMEP_SCENE_MAPPING
+			if (mapping != nullptr) { unmapFile(mapping, mapping_size); }
+#endif
+
+			std::throw_with_nested(ENGINE_EXCEPTION(
+				std::format("Failed reading compiled scene '{}'", file_path.string())
+			));
+		}
+	}
+
+	CompiledScene::CompiledScene(std::vector<std::byte>&& with_bytes)
+		: owned_bytes(std::move(with_bytes)), bytes(owned_bytes)
+	{
+		validate();
+	}
+
+	CompiledScene::~CompiledScene()
+	{
+#ifdef CMEP_SCENE_MAPPING
+		if (mapping != nullptr) { unmapFile(mapping, mapping_size); }
+#endif
+	}
+
+	bool CompiledScene::isCurrentFormat(const std::filesystem::path& file_path)
+	{
+		std::ifstream file(file_path, std::ios::binary);
+
+		SceneFormat::Header header{};
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+		return file.gcount() == sizeof(header) && header.magic == SceneFormat::magic &&
+			   header.version == SceneFormat::version;
+	}
+
+	std::span<const SceneFormat::AssetRecord> CompiledScene::getAssets() const noexcept
+	{
+		return getSection<SceneFormat::AssetRecord>(getHeader().assets);
+	}
+
+	std::span<const SceneFormat::EventHandlerRecord> CompiledScene::getEventHandlers(
+	) const noexcept
+	{
+		return getSection<SceneFormat::EventHandlerRecord>(getHeader().event_handlers);
+	}
+
+	std::span<const SceneFormat::TemplateRecord> CompiledScene::getTemplates() const noexcept
+	{
+		return getSection<SceneFormat::TemplateRecord>(getHeader().templates);
+	}
+
+	std::span<const SceneFormat::SupplyRecord>
+	CompiledScene::getSupplyData(const SceneFormat::Section& range) const noexcept
+	{
+		return getSection<SceneFormat::SupplyRecord>(getHeader().supply_data)
+			.subspan(range.offset, range.count);
+	}
+
+	std::string_view CompiledScene::getString(const SceneFormat::StringRef& ref) const noexcept
+	{
+		const auto* table = reinterpret_cast<const char*>(
+			bytes.data() + getHeader().string_table_offset
+		);
+
+		return {table + ref.offset, ref.length};
+	}
+
+#pragma endregion
+
+#pragma region Private
+
+	const SceneFormat::Header& CompiledScene::getHeader() const noexcept
+	{
+		return *reinterpret_cast<const SceneFormat::Header*>(bytes.data());
+	}
+
+	template <SceneFormat::Record record_t>
+	std::span<const record_t> CompiledScene::getSection(const SceneFormat::Section& section
+	) const noexcept
+	{
+		return {reinterpret_cast<const record_t*>(bytes.data() + section.offset), section.count};
+	}
+
+	void CompiledScene::validate() const
+	{
+		EXCEPTION_ASSERT(bytes.size() >= sizeof(SceneFormat::Header), "File too small for header!");
+
+		const auto& header = getHeader();
+		EXCEPTION_ASSERT(header.magic == SceneFormat::magic, "File is not a compiled scene!");
+		EXCEPTION_ASSERT(
+			header.version == SceneFormat::version,
+			std::format(
+				"Compiled with format version {}, expected {}! Recompile the scene",
+				header.version,
+				SceneFormat::version
+			)
+		);
+
+		EXCEPTION_ASSERT(
+			isInRange(header.string_table_offset, header.string_table_size, bytes.size()),
+			"String table out of range!"
+		);
+
+		const auto check_section = [&]<SceneFormat::Record record_t>(
+									   const SceneFormat::Section& section,
+									   std::string_view			   name
+								   ) {
+			EXCEPTION_ASSERT(
+				section.offset % SceneFormat::record_alignment == 0 &&
+					isInRange(
+						section.offset,
+						static_cast<uint64_t>(section.count) * sizeof(record_t),
+						bytes.size()
+					),
+				std::format("Section '{}' out of range!", name)
+			);
+		};
+
+		check_section.operator()<SceneFormat::AssetRecord>(header.assets, "assets");
+		check_section.operator()<SceneFormat::EventHandlerRecord>(header.event_handlers, "events");
+		check_section.operator()<SceneFormat::TemplateRecord>(header.templates, "templates");
+		check_section.operator()<SceneFormat::SupplyRecord>(header.supply_data, "supply_data");
+
+		const auto check_string = [&](const SceneFormat::StringRef& ref) {
+			EXCEPTION_ASSERT(
+				isInRange(ref.offset, ref.length, header.string_table_size),
+				"String out of range!"
+			);
+		};
+
+		for (const auto& asset : getAssets())
+		{
+			check_string(asset.name);
+			check_string(asset.location);
+		}
+
+		for (const auto& event_handler : getEventHandlers())
+		{
+			check_string(event_handler.script);
+			check_string(event_handler.function);
+		}
+
+		for (const auto& object_template : getTemplates())
+		{
+			check_string(object_template.name);
+			check_string(object_template.shader);
+
+			for (const auto& range :
+				 {object_template.renderer_supply, object_template.meshbuilder_supply})
+			{
+				EXCEPTION_ASSERT(
+					isInRange(range.offset, range.count, header.supply_data.count),
+					"Supply data of template out of range!"
+				);
+			}
+		}
+
+		for (const auto& supply : getSection<SceneFormat::SupplyRecord>(header.supply_data))
+		{
+			check_string(supply.value);
+		}
+	}
+
+#pragma endregion
+} // namespace Engine
@@ -3,9 +3,13 @@
 #include "Assets/AssetManager.hpp"
 #include "Rendering/MeshBuilders/AxisMeshBuilder.hpp"
 #include "Rendering/Renderers/Renderer.hpp"
+#include "Rendering/RenderQueue.hpp"
+#include "Rendering/RenderThread.hpp"
 #include "Rendering/Vulkan/backend.hpp"
 #include "Rendering/Vulkan/exports.hpp"
 
+#include "Scripting/ILuaScript.hpp"
+
 #include "Factories/ObjectFactory.hpp"
 
 #include "Logging/Logging.hpp"
@@ -13,86 +17,45 @@
 #include "EnumStringConvertor.hpp"
 #include "EventHandling.hpp"
 #include "Exception.hpp"
+#include "FrameScheduler.hpp"
 #include "GLFW/glfw3.h"
+#include "InputRecording.hpp"
+#include "JobSystem.hpp"
+#include "MemoryUsage.hpp"
+#include "Profiling.hpp"
 #include "SceneManager.hpp"
 #include "SceneObject.hpp"
 #include "TimeMeasure.hpp"
 #include "buildinfo.hpp"
+#include "lua.hpp"
 #include "nlohmann/json.hpp"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <format>
 #include <fstream>
 #include <memory>
 #include <queue>
+#include <random>
 #include <ratio>
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <thread>
 #include <utility>
+#include <vector>
 
 namespace Engine
 {
 	namespace
 	{
-		// Utility sleep function
-		// algorithm I found somewhere on stackoverflow
-		void spinSleep(double seconds)
-		{
-			// Return if under some small value
-			constexpr double bypass_limit = 0.001;
-			if (seconds < bypass_limit) { return; }
-
-			constexpr double spin_init = 5e-3;
-
-			double	estimate   = spin_init;
-			double	mean	   = spin_init;
-			double	sumsquares = 0; // also known as m2
-			int64_t count	   = 1;
-
-			while (seconds > estimate)
-			{
-				// Perform measured sleep
-				const auto sleep_start = std::chrono::steady_clock::now();
-				std::this_thread::sleep_for(std::chrono::milliseconds(2));
-				const auto sleep_end = std::chrono::steady_clock::now();
-
-				// Observed passage of time in seconds
-				// should be roughly equal to time specified in sleep_fore
-				const double observed =
-					std::chrono::duration<double>(sleep_end - sleep_start).count();
-
-				// Substract observed passage of time
-				// from total needed amount of sleep
-				seconds -= observed;
-
-				count++;
-				// change against mean average
-				const double delta = observed - mean;
-				// create new mean by adding current change to it
-				mean += delta / static_cast<double>(count);
-				// sum of squares accumulate
-				sumsquares += delta * (observed - mean);
-				// calculate standard deviation
-				const double stddev = sqrt(sumsquares / static_cast<double>(count - 1));
-				estimate			= mean + stddev;
-			}
-
-			// spin lock
-			const auto spin_start = std::chrono::steady_clock::now();
-			while (std::chrono::duration<double>(std::chrono::steady_clock::now() - spin_start)
-					   .count() < seconds)
-			{}
-		}
-
-		void handleMouseInput(
-			Engine*							 origin_engine,
-			double							 delta_time,
-			const Rendering::Vulkan::Window* window
+		void gatherMouseInput(
+			const Rendering::Vulkan::Window*		window,
+			std::vector<EventHandling::InputEvent>& inputs
 		)
 		{
 			const auto& screen_size = window->getFramebufferSize();
@@ -113,25 +76,21 @@ namespace Engine
 				if ((window->cursor_position.x - last_pos.x) != 0.0 ||
 					(window->cursor_position.y - last_pos.y) != 0.0)
 				{
-					auto event =
-						EventHandling::Event(origin_engine, EventHandling::EventType::onMouseMoved);
-
-					event.mouse.x = std::clamp(
-						window->cursor_position.x - last_pos.x,
-						-clamp_difference,
-						clamp_difference
+					inputs.push_back(
+						{.type	= EventHandling::InputEvent::Type::mouseMoved,
+						 .mouse = {
+							 std::clamp(
+								 window->cursor_position.x - last_pos.x,
+								 -clamp_difference,
+								 clamp_difference
+							 ),
+							 std::clamp(
+								 window->cursor_position.y - last_pos.y,
+								 -clamp_difference,
+								 clamp_difference
+							 ),
+						 }}
 					);
-					event.mouse.y = std::clamp(
-						window->cursor_position.y - last_pos.y,
-						-clamp_difference,
-						clamp_difference
-					);
-
-					event.delta_time = delta_time;
-
-					// Fire event, throw exception if return code is non-zero
-					int event_return = origin_engine->fireEvent(event);
-					EXCEPTION_ASSERT(event_return == 0, "Input Event returned non-zero!");
 
 					// Set last position to the current position
 					last_pos = window->cursor_position;
@@ -139,10 +98,9 @@ namespace Engine
 			}
 		}
 
-		void handleKeyboardInput(
-			Engine*										  origin_engine,
-			double										  delta_time,
-			std::queue<Rendering::Vulkan::KeyboardEvent>& event_queue
+		void gatherKeyboardInput(
+			std::queue<Rendering::Vulkan::KeyboardEvent>& event_queue,
+			std::vector<EventHandling::InputEvent>&		  inputs
 		)
 		{
 			// Handle every event in the queue
@@ -150,27 +108,23 @@ namespace Engine
 			{
 				auto& input_event = event_queue.front();
 
-				int event_return = 0;
-
 				switch (input_event.type)
 				{
 					case Rendering::Vulkan::KeyboardEvent::KEY_PRESS:
 					case Rendering::Vulkan::KeyboardEvent::KEY_REPEAT:
 					{
-						auto event =
-							EventHandling::Event(origin_engine, EventHandling::EventType::onKeyDown);
-						event.keycode	 = static_cast<uint16_t>(input_event.key);
-						event.delta_time = delta_time;
-						event_return	 = origin_engine->fireEvent(event);
+						inputs.push_back(
+							{.type	  = EventHandling::InputEvent::Type::keyDown,
+							 .keycode = static_cast<uint16_t>(input_event.key)}
+						);
 						break;
 					}
 					case Rendering::Vulkan::KeyboardEvent::KEY_RELEASE:
 					{
-						auto event =
-							EventHandling::Event(origin_engine, EventHandling::EventType::onKeyUp);
-						event.keycode	 = static_cast<uint16_t>(input_event.key);
-						event.delta_time = delta_time;
-						event_return	 = origin_engine->fireEvent(event);
+						inputs.push_back(
+							{.type	  = EventHandling::InputEvent::Type::keyUp,
+							 .keycode = static_cast<uint16_t>(input_event.key)}
+						);
 						break;
 					}
 					default:
@@ -178,20 +132,221 @@ namespace Engine
 						throw ENGINE_EXCEPTION("Unknown input event!");
 					}
 				}
+			}
+		}
 
-				// Throw exception on non-zero event return code
-				EXCEPTION_ASSERT(event_return == 0, "Input Event returned non-zero!");
+		/**
+		 * Convert an input into the matching per-event type event
+		 */
+		EventHandling::Event
+		makeSingleInputEvent(Engine* origin_engine, const EventHandling::InputEvent& input)
+		{
+			switch (input.type)
+			{
+				case EventHandling::InputEvent::Type::keyDown:
+				{
+					auto event = EventHandling::Event(origin_engine, EventHandling::EventType::onKeyDown);
+					event.keycode = input.keycode;
+					return event;
+				}
+				case EventHandling::InputEvent::Type::keyUp:
+				{
+					auto event = EventHandling::Event(origin_engine, EventHandling::EventType::onKeyUp);
+					event.keycode = input.keycode;
+					return event;
+				}
+				case EventHandling::InputEvent::Type::mouseMoved:
+				{
+					auto event =
+						EventHandling::Event(origin_engine, EventHandling::EventType::onMouseMoved);
+					event.mouse = input.mouse;
+					return event;
+				}
 			}
+
+			throw ENGINE_EXCEPTION("Unknown input event!");
+		}
+
+		void writeTextFile(const std::string& path, const std::string& text)
+		{
+			std::ofstream file(path, std::ios::trunc);
+			if (!file.is_open()) { throw ENGINE_EXCEPTION(std::format("Could not open '{}'", path)); }
+
+			file << text;
 		}
 	} // namespace
 
-	void Engine::handleInput(const double delta_time)
+	static_assert(GLFW_KEY_LAST < EventHandling::key_code_count, "Key states can't hold every key!");
+
+	bool Engine::isKeyDown(int keycode) const
 	{
+		if (keycode < 0 || static_cast<size_t>(keycode) >= key_states.size()) { return false; }
+
+		return key_states.test(static_cast<size_t>(keycode));
+	}
+
+	void Engine::seedScriptRandom(Scene& scene)
+	{
+		// Live sessions keep the default seed
+		if (input_mode == InputMode::live) { return; }
+
+		scene.asset_repository->forEachAsset<Scripting::ILuaScript>(
+			[&](const std::string& name, const auto& script) {
+				lua_State* state = script->getState();
+
+				lua_getglobal(state, "math");
+				lua_getfield(state, -1, "randomseed");
+				lua_pushnumber(state, static_cast<lua_Number>(input_recording.seed));
+
+				if (lua_pcall(state, 1, 0, 0) != 0)
+				{
+					this->logger->logSingle<decltype(this)>(
+						Logging::LogLevel::Warning,
+						"Failed seeding math.random of script '{}': {}",
+						name,
+						lua_tostring(state, -1)
+					);
+					lua_pop(state, 1);
+				}
+
+				// Pop the math table
+				lua_pop(state, 1);
+			}
+		);
+	}
+
+	void Engine::recordInput(const std::string& path)
+	{
+		input_mode			 = InputMode::record;
+		input_recording_path = path;
+	}
+
+	void Engine::replayInput(const std::string& path)
+	{
+		input_mode			 = InputMode::replay;
+		input_recording_path = path;
+	}
+
+	double Engine::handleInput(double delta_time)
+	{
+		PROFILE_ZONE("Engine::handleInput");
+
 		auto* window_data = vk_instance->getWindow();
 
-		handleMouseInput(this, delta_time, window_data);
+		frame_inputs.clear();
+		frame_mouse_delta = {};
+
+		if (input_mode == InputMode::replay)
+		{
+			// Live input is discarded while replaying
+			window_data->keyboard_events = {};
+
+			if (replay_frame < input_recording.frames.size())
+			{
+				const auto& frame = input_recording.frames[replay_frame++];
+
+				frame_inputs.assign(frame.inputs.begin(), frame.inputs.end());
+				delta_time = frame.delta_time;
+			}
+
+			// Finish with the last recorded frame
+			if (replay_frame >= input_recording.frames.size()) { stop(); }
+		}
+		else
+		{
+			gatherMouseInput(window_data, frame_inputs);
+			gatherKeyboardInput(window_data->keyboard_events, frame_inputs);
+
+			if (input_mode == InputMode::record)
+			{
+				input_recording.frames.push_back({.delta_time = delta_time, .inputs = frame_inputs});
+			}
+		}
+
+		// Key state is derived from the gathered input so that replays reproduce it
+		for (const auto& input : frame_inputs)
+		{
+			switch (input.type)
+			{
+				case EventHandling::InputEvent::Type::keyDown:
+				case EventHandling::InputEvent::Type::keyUp:
+				{
+					if (input.keycode < key_states.size())
+					{
+						key_states.set(
+							input.keycode,
+							input.type == EventHandling::InputEvent::Type::keyDown
+						);
+					}
+					break;
+				}
+				case EventHandling::InputEvent::Type::mouseMoved:
+				{
+					frame_mouse_delta += input.mouse;
+					break;
+				}
+			}
+		}
+
+		if (frame_inputs.empty()) { return delta_time; }
+
+		// Per-event delivery, kept for scripts that handle single events
+		for (const auto& input : frame_inputs)
+		{
+			auto event		 = makeSingleInputEvent(this, input);
+			event.delta_time = delta_time;
+
+			// Throw exception on non-zero event return code
+			const int event_return = fireEvent(event);
+			EXCEPTION_ASSERT(event_return == 0, "Input Event returned non-zero!");
+		}
 
-		handleKeyboardInput(this, delta_time, window_data->keyboard_events);
+		// Batched delivery, every input of this frame in one call
+		auto input_event	   = EventHandling::Event(this, EventHandling::EventType::onInput);
+		input_event.delta_time = delta_time;
+		input_event.inputs	   = frame_inputs;
+
+		const int event_return = fireEvent(input_event);
+		EXCEPTION_ASSERT(event_return == 0, "Input Event returned non-zero!");
+
+		return delta_time;
+	}
+
+	int Engine::handleFixedUpdate(const double delta_time)
+	{
+		if (config.tick_rate == 0) { return 0; }
+
+		PROFILE_ZONE("Engine::handleFixedUpdate");
+
+		// Limit the number of ticks per frame,
+		// otherwise a slow tick would cause more ticks to be needed next frame
+		constexpr uint_fast16_t max_ticks_per_frame = 8;
+
+		const double fixed_delta = 1.0 / config.tick_rate;
+
+		auto fixed_event	   = EventHandling::Event(this, EventHandling::EventType::onFixedUpdate);
+		fixed_event.delta_time = fixed_delta;
+
+		fixed_accumulator += delta_time;
+
+		uint_fast16_t tick_count = 0;
+		for (; fixed_accumulator >= fixed_delta && tick_count < max_ticks_per_frame; tick_count++)
+		{
+			const int ret = fireEvent(fixed_event);
+			if (ret != 0) { return ret; }
+
+			fixed_accumulator -= fixed_delta;
+		}
+
+		// Drop time we could not catch up on
+		if (tick_count == max_ticks_per_frame)
+		{
+			fixed_accumulator = std::fmod(fixed_accumulator, fixed_delta);
+		}
+
+		interpolation_alpha = fixed_accumulator / fixed_delta;
+
+		return 0;
 	}
 
 	void Engine::handleConfig()
@@ -224,6 +379,58 @@ namespace Engine
 			.default_scene = data["default_scene"].get<std::string>(),
 
 		};
+
+		config.render_thread = data["rendering"].value("renderThread", false);
+
+		// Simulation section is optional
+		if (data.contains("simulation"))
+		{
+			config.tick_rate = data["simulation"].value("tickRate", config.tick_rate);
+		}
+
+		// Threading section is optional
+		if (data.contains("threading"))
+		{
+			config.job_workers = data["threading"].value("workers", size_t{0});
+		}
+
+		// Scene memory section is optional, budgets are given in MiB
+		if (data.contains("scenes"))
+		{
+			constexpr size_t mebibyte = size_t{1024} * 1024;
+
+			config.scene_memory = {
+				.cpu_budget = data["scenes"].value("cpuBudgetMiB", size_t{0}) * mebibyte,
+				.gpu_budget = data["scenes"].value("gpuBudgetMiB", size_t{0}) * mebibyte,
+			};
+		}
+
+		// Headless section is optional
+		if (data.contains("headless"))
+		{
+			const auto& headless = data["headless"];
+
+			config.headless = {
+				.enabled	 = headless.value("enabled", false),
+				.frame_limit = headless.value("frames", uint_fast64_t{0}),
+				.time_limit	 = headless.value("seconds", 0.0),
+			};
+		}
+
+		if (headless_override.has_value()) { config.headless = headless_override.value(); }
+
+		// Profiling section is optional
+		if (data.contains("profiling"))
+		{
+			const auto& profiling = data["profiling"];
+
+			config.profiling = {
+				.trace_file		= profiling.value("traceFile", std::string()),
+				.trace_frames	= profiling.value("traceFrames", size_t{0}),
+				.stats_file		= profiling.value("statsFile", std::string()),
+				.stats_interval = profiling.value("statsInterval", 5.0),
+			};
+		}
 	}
 
 	void Engine::renderCallback(
@@ -235,19 +442,284 @@ namespace Engine
 		auto* engine_cast	= static_cast<Engine*>(engine);
 		auto  current_scene = engine_cast->scene_manager->getSceneCurrent();
 
-		const auto& objects = current_scene->getAllObjects();
+		auto& items = engine_cast->direct_items;
+		auto& queue = engine_cast->direct_queue;
+
+		items.clear();
 
-		for (const auto& [name, ptr] : objects)
+		const auto renderers = current_scene->getObjects().getRenderers();
+		for (size_t idx = 0; idx < renderers.size(); idx++)
 		{
+			if (!engine_cast->frustum_culler.isVisible(idx)) { continue; }
+
 			try
 			{
-				ptr->getRenderer()->render(command_buffer, current_frame);
+				items.push_back(renderers[idx]->prepareRender());
 			}
 			catch (...)
 			{
 				std::throw_with_nested(ENGINE_EXCEPTION("Caught exception rendering object!"));
 			}
 		}
+
+		queue.sort(items, engine_cast->frame_data);
+		engine_cast->render_stats = queue.getStats();
+
+		engine_cast->pipeline_manager->bindFrameData(
+			*command_buffer,
+			current_frame,
+			engine_cast->frame_data
+		);
+
+		queue.record(items, command_buffer, current_frame);
+	}
+
+	void Engine::buildScene(const std::shared_ptr<Scene>& scene)
+	{
+		using dur_milli_t = std::chrono::duration<double, std::milli>;
+
+		PROFILE_ZONE("Scene build");
+		TIMEMEASURE_START(scenebuild);
+
+		struct BuildEntry
+		{
+			const std::string*		 name;
+			const char*				 zone_name;
+			Rendering::IMeshBuilder* builder;
+			dur_milli_t				 generate_time;
+		};
+
+		const auto& objects = scene->getObjects();
+		const auto	names	= objects.getNames();
+		const auto	ptrs	= objects.getObjects();
+
+		this->logger->logSingle<decltype(this)>(
+			Logging::LogLevel::Info,
+			"Starting scene build ({} objects, {} workers)",
+			objects.count(),
+			job_system->getWorkerCount()
+		);
+
+		// Builders that call into Lua all share one job, others get one job each
+		std::vector<BuildEntry> parallel_entries;
+		std::vector<BuildEntry> serial_entries;
+		for (size_t idx = 0; idx < ptrs.size(); idx++)
+		{
+			auto* builder = ptrs[idx]->getMeshBuilder();
+
+			auto& entries = builder->isGenerateThreadSafe() ? parallel_entries : serial_entries;
+
+			// Interned here so that workers don't contend for the name registry
+			entries.push_back(
+				{.name			= &names[idx],
+				 .zone_name		= Base::Profiling::internName(names[idx]),
+				 .builder		= builder,
+				 .generate_time = {}}
+			);
+		}
+
+		auto generate_entry = [](BuildEntry& entry) {
+			PROFILE_ZONE_CATEGORY(entry.zone_name, "mesh");
+			TIMEMEASURE_START(generate);
+
+			entry.builder->generate();
+
+			TIMEMEASURE_END_MILLI(generate);
+			entry.generate_time = generate_total;
+		};
+
+		// CPU phase
+		TIMEMEASURE_START(generate_phase);
+		{
+			const std::array<Base::JobHandle, 2> phase_jobs = {
+				job_system->parallelFor(
+					parallel_entries.size(),
+					1,
+					[&](size_t begin, size_t end) {
+						for (size_t idx = begin; idx < end; idx++)
+						{
+							generate_entry(parallel_entries[idx]);
+						}
+					}
+				),
+				job_system->schedule([&]() {
+					for (auto& entry : serial_entries) { generate_entry(entry); }
+				})
+			};
+
+			for (const auto& job : phase_jobs) { job_system->wait(job); }
+		}
+		TIMEMEASURE_END_MILLI(generate_phase);
+
+		// GPU phase, upload all meshes with a single submission
+		TIMEMEASURE_START(upload_phase);
+		{
+			PROFILE_ZONE("Scene upload");
+
+			auto command_buffer = vk_instance->getCommandPool()->constructCommandBuffer();
+			std::vector<std::unique_ptr<Rendering::Vulkan::StagingBuffer>> staging;
+
+			command_buffer.beginOneTime();
+			for (auto& entries : {&parallel_entries, &serial_entries})
+			{
+				for (auto& entry : *entries) { entry.builder->upload(command_buffer, staging); }
+			}
+			command_buffer.end();
+
+			if (!staging.empty())
+			{
+				command_buffer.queueSubmit(vk_instance->getLogicalDevice()->getGraphicsQueue());
+			}
+		}
+		TIMEMEASURE_END_MILLI(upload_phase);
+
+		// Per-object report, slowest first
+		std::vector<BuildEntry> all_entries = std::move(parallel_entries);
+		all_entries.insert(all_entries.end(), serial_entries.begin(), serial_entries.end());
+		std::ranges::sort(all_entries, [](const BuildEntry& lhs, const BuildEntry& rhs) {
+			return lhs.generate_time > rhs.generate_time;
+		});
+
+		for (const auto& entry : all_entries)
+		{
+			this->logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Debug,
+				"Built object '{}' in {:.3f}ms ({} vertices)",
+				*entry.name,
+				entry.generate_time.count(),
+				entry.builder->getContext().vbo_vert_count
+			);
+		}
+
+		TIMEMEASURE_END_MILLI(scenebuild);
+
+		frame_stats.setCounter("sceneBuildMs", scenebuild_total.count());
+		frame_stats.setCounter("sceneObjects", static_cast<double>(objects.count()));
+
+		this->logger->logSingle<decltype(this)>(
+			Logging::LogLevel::Info,
+			"Scene build finished in {:.3f}ms (generate {:.3f}ms, upload {:.3f}ms{})",
+			scenebuild_total.count(),
+			generate_phase_total.count(),
+			upload_phase_total.count(),
+			all_entries.empty() ? std::string()
+								: std::format(
+									  ", slowest '{}' {:.3f}ms",
+									  *all_entries.front().name,
+									  all_entries.front().generate_time.count()
+								  )
+		);
+	}
+
+	void Engine::uploadPendingMeshes()
+	{
+		PROFILE_ZONE("Engine::uploadPendingMeshes");
+
+		const auto scene = scene_manager->getSceneCurrent();
+
+		// Meshes shared by template instances are uploaded with the others
+		std::vector<Rendering::IMeshBuilder*> builders = scene->getPendingTemplateMeshes();
+		for (auto* object : scene->getObjects().getObjects())
+		{
+			auto* builder = object->getMeshBuilder();
+			if (builder->needsRebuild()) { builders.push_back(builder); }
+		}
+
+		if (builders.empty()) { return; }
+
+		auto* command_buffer = vk_instance->getCommandPool()->allocateCommandBuffer();
+		std::vector<std::unique_ptr<Rendering::Vulkan::StagingBuffer>> staging;
+
+		command_buffer->beginOneTime();
+		for (auto* builder : builders)
+		{
+			builder->generate();
+			builder->upload(*command_buffer, staging);
+		}
+		command_buffer->barrierTransferToVertexInput();
+		command_buffer->end();
+
+		if (!staging.empty())
+		{
+			command_buffer->queueSubmitAsync(vk_instance->getLogicalDevice()->getGraphicsQueue());
+		}
+
+		// Released once the frames after this submission have finished
+		auto* deletion_queue = vk_instance->getDeletionQueue();
+		deletion_queue->retire(command_buffer);
+		for (auto& buffer : staging) { deletion_queue->retire(std::move(buffer)); }
+	}
+
+	void Engine::gatherSnapshot()
+	{
+		auto& snapshot = render_thread->getBackSnapshot();
+
+		snapshot.items.clear();
+		snapshot_deferred.clear();
+
+		snapshot.frame_data = frame_data;
+
+		const auto renderers = scene_manager->getSceneCurrent()->getObjects().getRenderers();
+		snapshot.items.reserve(renderers.size());
+
+		for (size_t idx = 0; idx < renderers.size(); idx++)
+		{
+			auto* renderer = renderers[idx];
+			if (!frustum_culler.isVisible(idx)) { continue; }
+
+			// Resource updates could race with the frame being drawn, reserve a slot for later
+			if (renderer->needsResourceUpdate())
+			{
+				snapshot_deferred.emplace_back(snapshot.items.size(), renderer);
+				snapshot.items.emplace_back();
+				continue;
+			}
+
+			snapshot.items.push_back(renderer->prepareRender());
+		}
+	}
+
+	void Engine::submitSnapshot()
+	{
+		auto& snapshot = render_thread->getBackSnapshot();
+
+		uploadPendingMeshes();
+
+		for (const auto& [index, renderer] : snapshot_deferred)
+		{
+			try
+			{
+				snapshot.items[index] = renderer->prepareRender();
+			}
+			catch (...)
+			{
+				std::throw_with_nested(ENGINE_EXCEPTION("Caught exception preparing object!"));
+			}
+		}
+
+		snapshot.queue.sort(snapshot.items, snapshot.frame_data);
+		render_stats = snapshot.queue.getStats();
+
+		render_thread->submit();
+	}
+
+	void Engine::registerIdleTasks()
+	{
+		// Step the garbage collectors of the current scene's scripts
+		// so that full collections don't have to happen during frame work
+		frame_scheduler.addIdleTask("Lua GC", [this](FrameScheduler::clock_t::duration) {
+			auto scene = scene_manager->getSceneCurrent();
+
+			bool has_more = false;
+			scene->asset_repository->forEachAsset<Scripting::ILuaScript>(
+				[&](const std::string&, const auto& script) {
+					// Returns 1 when the step finished a collection cycle
+					if (lua_gc(script->getState(), LUA_GCSTEP, 0) == 0) { has_more = true; }
+				}
+			);
+
+			return has_more;
+		});
 	}
 
 	void Engine::engineLoop()
@@ -280,34 +752,15 @@ namespace Engine
 			config.framerate_target == 0 ? " (VSYNC)" : ""
 		);
 
-		// Build scene
+		// Build scene, generators need the world positions of their objects
+		try
 		{
-			TIMEMEASURE_START(scenebuild);
-
-			const auto& objects = scene->getAllObjects();
-
-			this->logger->logSingle<decltype(this)>(
-				Logging::LogLevel::Info,
-				"Starting scene build ({} objects)",
-				objects.size()
-			);
-			for (const auto& [name, object] : objects)
-			{
-				this->logger->logSingle<decltype(this)>(
-					Logging::LogLevel::Debug,
-					"Building object '{}'",
-					name
-				);
-				object->getMeshBuilder()->build();
-			}
-
-			TIMEMEASURE_END_MILLI(scenebuild);
-
-			this->logger->logSingle<decltype(this)>(
-				Logging::LogLevel::Info,
-				"Scene build finished in {:.3f}ms",
-				scenebuild_total.count()
-			);
+			scene->updateTransforms();
+			buildScene(scene);
+		}
+		catch (...)
+		{
+			std::throw_with_nested(ENGINE_EXCEPTION("Exception building scene!"));
 		}
 
 		// Show window
@@ -316,28 +769,65 @@ namespace Engine
 
 		dur_milli_t avg_event{};
 		uint64_t	avg_event_count{};
+		double		avg_idle_utilisation{};
+
+		// Without a framerate target frames are paced by VSYNC, assume a 60Hz display
+		frame_stats.setBudget(
+			1000.0 / (config.framerate_target != 0 ? config.framerate_target : 60.0)
+		);
 
-		auto prev_clock = std::chrono::steady_clock::now();
+		// Periodic statistics summaries are written off the engine thread
+		Base::JobHandle stats_write_job;
 
-		bool first_frame = true;
+		const auto& run_limits = config.headless;
+		const bool	is_headless = vk_instance->isHeadless();
+
+		const auto loop_start		= std::chrono::steady_clock::now();
+		auto	   prev_clock		= loop_start;
+		auto	   last_stats_write = loop_start;
+
+		bool first_frame	   = true;
+		bool first_frame_drawn = false;
 		// hot loop
 		while (!glfw_window->getShouldClose())
 		{
+			PROFILE_FRAME_MARK();
+			PROFILE_ZONE_CATEGORY("Frame", "frame");
+
 			const auto next_clock = std::chrono::steady_clock::now();
 
+			// Run work that other threads handed back to the engine thread
+			{
+				PROFILE_ZONE("JobSystem::runMainThreadJobs");
+				job_system->runMainThreadJobs();
+			}
+
 			constexpr dur_second_t min_delta = 0.0001s;
 			constexpr dur_second_t max_delta = 10000.0s;
 			const auto			   delta_time =
 				std::clamp(dur_second_t(next_clock - prev_clock), min_delta, max_delta);
-			last_delta_time = delta_time.count();
 
 			// Check return code of FireEvent (events should return non-zero codes as failure)
 			if (!first_frame)
 			{
-				handleInput(delta_time.count());
+				// Replays simulate the recorded delta time instead of the measured one
+				const double frame_delta = handleInput(delta_time.count());
+				last_delta_time			 = frame_delta;
 
-				on_update_event.delta_time = delta_time.count();
-				const auto ret			   = fireEvent(on_update_event);
+				const auto fixed_ret = handleFixedUpdate(frame_delta);
+				if (fixed_ret != 0)
+				{
+					this->logger->logSingle<decltype(this)>(
+						Logging::LogLevel::Error,
+						"Firing event onFixedUpdate returned {}! Exiting event-loop",
+						fixed_ret
+					);
+					break;
+				}
+
+				on_update_event.delta_time			= frame_delta;
+				on_update_event.interpolation_alpha = interpolation_alpha;
+				const auto ret						= fireEvent(on_update_event);
 				if (ret != 0)
 				{
 					this->logger->logSingle<decltype(this)>(
@@ -352,16 +842,84 @@ namespace Engine
 
 			const auto event_end = std::chrono::steady_clock::now();
 
+			// Apply all transform changes of this frame in one pass
+			{
+				PROFILE_ZONE("Scene::updateTransforms");
+				scene_manager->getSceneCurrent()->updateTransforms();
+			}
+
+			// Camera matrices are computed once here instead of per object
+			frame_data = scene_manager->getFrameUniformData();
+
+			// Skip objects that are off screen before anything is recorded
+			{
+				PROFILE_ZONE("FrustumCuller::cull");
+
+				const auto& objects = scene_manager->getSceneCurrent()->getObjects();
+				frustum_culler.cull(objects.getRenderers(), objects.getWorldBounds(), frame_data);
+			}
+
 			// Render
-			glfw_window->drawFrame();
+			if (render_thread)
+			{
+				// Previous frame is still being drawn, wait for it only after gathering
+				PROFILE_ZONE("Engine::gatherSnapshot");
+				gatherSnapshot();
+				render_thread->waitIdle();
+			}
+			else
+			{
+				uploadPendingMeshes();
+
+				PROFILE_ZONE("Window::drawFrame");
+				glfw_window->drawFrame();
+			}
+
+			// Destroy removed objects (and replaced meshes) that no frame in flight uses anymore
+			// (the render thread is idle at this point)
+			{
+				PROFILE_ZONE("DeletionQueue::collect");
+				vk_instance->getDeletionQueue()->collect();
+			}
+
+			// Scenes loading in the background create a few GPU resources per frame
+			{
+				PROFILE_ZONE("SceneManager::update");
+				scene_manager->update();
+			}
 
 			const auto draw_end = std::chrono::steady_clock::now();
 
+			if (!first_frame_drawn)
+			{
+				first_frame_drawn = true;
+
+				const dur_milli_t first_frame_total = draw_end - run_start;
+				frame_stats.setCounter("timeToFirstFrameMs", first_frame_total.count());
+
+				this->logger->logSingle<decltype(this)>(
+					Logging::LogLevel::Info,
+					"First frame drawn {:.3f}ms after start",
+					first_frame_total.count()
+				);
+			}
+
 			// Sync with glfw event loop
-			glfwPollEvents();
+			// (may recreate the swapchain, the render thread is idle at this point)
+			if (!is_headless)
+			{
+				PROFILE_ZONE("glfwPollEvents");
+				glfwPollEvents();
+			}
 
 			const auto poll_end = std::chrono::steady_clock::now();
 
+			if (render_thread)
+			{
+				PROFILE_ZONE("Engine::submitSnapshot");
+				submitSnapshot();
+			}
+
 			const dur_milli_t event_total = (event_end - next_clock);
 			const dur_milli_t draw_total  = (draw_end - event_end);
 			const dur_milli_t poll_total  = (poll_end - draw_end);
@@ -371,6 +929,46 @@ namespace Engine
 			avg_event += event_total;
 			avg_event_count++;
 
+			frame_stats.record(
+				dur_milli_t(delta_time).count(),
+				event_total.count(),
+				draw_total.count(),
+				poll_total.count()
+			);
+
+			if (!config.profiling.stats_file.empty() && stats_write_job.isDone() &&
+				dur_second_t(poll_end - last_stats_write).count() >= config.profiling.stats_interval)
+			{
+				last_stats_write = poll_end;
+
+				updateStatCounters();
+
+				stats_write_job = job_system->schedule(
+					[this, text = frame_stats.toJson(), path = config.profiling.stats_file]() {
+						try
+						{
+							writeTextFile(path, text);
+						}
+						catch (const std::exception& e)
+						{
+							this->logger->logSingle<decltype(this)>(
+								Logging::LogLevel::Exception,
+								"Caught exception writing frame statistics! e.what(): {}",
+								Base::unrollExceptions(e)
+							);
+						}
+					}
+				);
+			}
+
+			// Stop once a frame or time limit is reached
+			if ((run_limits.frame_limit != 0 && avg_event_count >= run_limits.frame_limit) ||
+				(run_limits.time_limit != 0.0 &&
+				 dur_second_t(poll_end - loop_start).count() >= run_limits.time_limit))
+			{
+				stop();
+			}
+
 			// Warn if a frame takes too long or is too short
 			constexpr dur_milli_t limits[] = {12.0ms, 19.0ms, 8.0ms};
 			if (event_total > limits[0] || sum_total > limits[1] || sum_total < limits[2])
@@ -386,25 +984,77 @@ namespace Engine
 				);
 			}
 
-			// Time the frame actually took to render
-			const dur_second_t frame_actual = std::chrono::steady_clock::now() - next_clock;
-			// Time we want the frame to take
-			const double frame_expected		= 1.0 / config.framerate_target;
-			const double frame_sleep		= frame_expected - frame_actual.count();
-			// If VSYNC is disabled and we need to sleep
-			if (config.framerate_target != 0 && frame_sleep > 0)
+			// If VSYNC is disabled, use the rest of the frame for idle work and wait
+			if (config.framerate_target != 0)
 			{
-				spinSleep(frame_sleep);
+				PROFILE_ZONE("Idle");
+
+				// Time we want the frame to take
+				const auto frame_expected =
+					std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+						dur_second_t(1.0 / config.framerate_target)
+					);
+
+				frame_scheduler.waitUntil(next_clock + frame_expected);
+
+				avg_idle_utilisation += frame_scheduler.getLastStats().utilisation;
 			}
 
 			prev_clock = next_clock;
 		}
 
+		syncRenderThread();
+		job_system->wait(stats_write_job);
+
+		if (input_mode == InputMode::record)
+		{
+			try
+			{
+				input_recording.save(input_recording_path);
+
+				this->logger->logSingle<decltype(this)>(
+					Logging::LogLevel::Info,
+					"Recorded {} frames of input to '{}'",
+					input_recording.frames.size(),
+					input_recording_path
+				);
+			}
+			catch (const std::exception& e)
+			{
+				this->logger->logSingle<decltype(this)>(
+					Logging::LogLevel::Exception,
+					"Caught exception saving input recording! e.what(): {}",
+					Base::unrollExceptions(e)
+				);
+			}
+		}
+
+		const dur_second_t loop_total = std::chrono::steady_clock::now() - loop_start;
+
+		this->logger->logSingle<decltype(this)>(
+			is_headless ? Logging::LogLevel::Info : Logging::LogLevel::Debug,
+			"Closing engine ({} frames in {:.3f}s, frametime avg {:.3f}ms, eventtime avg {:.3}, "
+			"idle utilisation avg {:.1f}%)",
+			avg_event_count,
+			loop_total.count(),
+			dur_milli_t(loop_total).count() / static_cast<double>(avg_event_count),
+			avg_event.count() / static_cast<double>(avg_event_count),
+			avg_idle_utilisation * 100.0 / static_cast<double>(avg_event_count)
+		);
+
+		const auto frame_summary = frame_stats.getSummary(FrameStats::Metric::frame);
 		this->logger->logSingle<decltype(this)>(
-			Logging::LogLevel::Debug,
-			"Closing engine (eventtime avg {:.3})",
-			avg_event.count() / static_cast<double>(avg_event_count)
+			is_headless ? Logging::LogLevel::Info : Logging::LogLevel::Debug,
+			"Frametime p50 {:.3f}ms p95 {:.3f}ms p99 {:.3f}ms max {:.3f}ms, {} frames over budget",
+			frame_summary.p50,
+			frame_summary.p95,
+			frame_summary.p99,
+			frame_summary.max,
+			frame_stats.getOverBudgetCount()
 		);
+
+		if (!config.profiling.trace_file.empty()) { writeTrace(config.profiling.trace_file); }
+		if (!config.profiling.stats_file.empty()) { writeFrameStats(config.profiling.stats_file); }
 	}
 
 	int Engine::fireEvent(EventHandling::Event event)
@@ -421,6 +1071,8 @@ namespace Engine
 		{
 			try
 			{
+				PROFILE_ZONE_CATEGORY(handler->second.zone_name, "event");
+
 				// Call the handler
 				sum += handler->second(&event);
 			}
@@ -448,10 +1100,27 @@ namespace Engine
 	{
 		this->logger->logSingle<decltype(this)>(Logging::LogLevel::Info, "Destructor called");
 
+		// Stop drawing before the scene goes away
+		render_thread.reset();
+
+		// Frames in flight may still use objects of the scene
+		if (vk_instance != nullptr)
+		{
+			vk_instance->getLogicalDevice()->waitIdle();
+			vk_instance->getDeletionQueue()->flush();
+		}
+
+		// Finishes queued jobs, which may still reference the scene
+		job_system.reset();
+
 		scene_manager.reset();
 
 		asset_manager.reset();
 
+		// Destructors of the above retire their resources, pipelines among them have to be
+		// released before the pipeline manager
+		if (vk_instance != nullptr) { vk_instance->getDeletionQueue()->flush(); }
+
 		pipeline_manager.reset();
 
 		delete vk_instance;
@@ -459,9 +1128,12 @@ namespace Engine
 
 	void Engine::run()
 	{
-		TIMEMEASURE_START(run);
+		using dur_milli_t = std::chrono::duration<double, std::milli>;
+
+		run_start = std::chrono::steady_clock::now();
 
 		this->logger->mapCurrentThreadToName("engine");
+		Base::Profiling::setThreadName("engine");
 
 		// Engine info printout
 		this->logger->logSingle<decltype(this)>(
@@ -471,49 +1143,139 @@ namespace Engine
 			buildinfo_compiledby
 		);
 
-		// Load configuration
-		try
-		{
-			handleConfig();
-		}
-		catch (...)
-		{
-			std::throw_with_nested(ENGINE_EXCEPTION("Exception parsing config!"));
-		}
+		// Phases are timed separately and summarized once initialization finishes
+		std::vector<std::pair<const char*, double>> startup_phases;
+		auto startup_phase = [&](const char* name, auto&& phase) {
+			PROFILE_ZONE_CATEGORY(name, "startup");
+			TIMEMEASURE_START(startup_phase);
+
+			phase();
+
+			TIMEMEASURE_END_MILLI(startup_phase);
+			startup_phases.emplace_back(name, startup_phase_total.count());
+		};
 
-		asset_manager = std::make_shared<AssetManager>(logger);
-		scene_manager = std::make_shared<SceneManager>(this);
+		startup_phase("config", [&]() {
+			// Load configuration
+			try
+			{
+				handleConfig();
+			}
+			catch (...)
+			{
+				std::throw_with_nested(ENGINE_EXCEPTION("Exception parsing config!"));
+			}
 
-		vk_instance = new Rendering::Vulkan::Instance(
-			this->logger,
+			// The seed has to be known before scripts are initialized
+			switch (input_mode)
 			{
-				config.window.size,
-				config.window.title,
+				case InputMode::record:
 				{
-					{GLFW_VISIBLE, GLFW_FALSE},
-					{GLFW_RESIZABLE, GLFW_TRUE},
-				},
+					input_recording.seed = std::random_device()();
+					break;
+				}
+				case InputMode::replay:
+				{
+					input_recording = InputRecording::load(input_recording_path);
+
+					this->logger->logSingle<decltype(this)>(
+						Logging::LogLevel::Info,
+						"Replaying {} frames of input from '{}'",
+						input_recording.frames.size(),
+						input_recording_path
+					);
+					break;
+				}
+				case InputMode::live:
+				{
+					break;
+				}
 			}
-		);
+		});
 
-		vk_instance->getWindow()->setRenderCallback(Engine::renderCallback, this);
+		startup_phase("jobSystem", [&]() {
+			job_system =
+				std::make_unique<Base::JobSystem>(config.job_workers, [this](size_t index) {
+					this->logger->mapCurrentThreadToName(std::format("job{}", index));
+				});
 
-		pipeline_manager = std::make_shared<Rendering::Vulkan::PipelineManager>(
-			logger,
-			vk_instance,
-			config.game_path + config.shader_path
-		);
+			this->logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Debug,
+				"Started job system with {} workers",
+				job_system->getWorkerCount()
+			);
+		});
+
+		startup_phase("managers", [&]() {
+			asset_manager = std::make_shared<AssetManager>(logger);
+			scene_manager = std::make_shared<SceneManager>(this);
+			scene_manager->setMemoryBudget(
+				config.scene_memory.cpu_budget,
+				config.scene_memory.gpu_budget
+			);
 
-		scene_manager->setSceneLoadPrefix(config.game_path + config.scene_path);
-		scene_manager->loadScene(config.default_scene);
-		scene_manager->setScene(config.default_scene);
+			// Decode textures and compile scripts while the Vulkan instance is created
+			scene_manager->setSceneLoadPrefix(config.game_path + config.scene_path);
+			scene_manager->prefetchScene(config.default_scene);
+		});
+
+		startup_phase("vulkan", [&]() {
+			vk_instance = new Rendering::Vulkan::Instance(
+				this->logger,
+				{
+					config.window.size,
+					config.window.title,
+					{
+						{GLFW_VISIBLE, GLFW_FALSE},
+						{GLFW_RESIZABLE, GLFW_TRUE},
+					},
+					config.headless.enabled,
+				}
+			);
+		});
+
+		startup_phase("pipelines", [&]() {
+			pipeline_manager = std::make_shared<Rendering::Vulkan::PipelineManager>(
+				logger,
+				vk_instance,
+				config.game_path + config.shader_path
+			);
+
+			// Recording binds the per-frame data owned by the pipeline manager
+			if (config.render_thread)
+			{
+				render_thread = std::make_unique<Rendering::RenderThread>(
+					logger,
+					vk_instance->getWindow(),
+					pipeline_manager.get()
+				);
+			}
+			else { vk_instance->getWindow()->setRenderCallback(Engine::renderCallback, this); }
+		});
 
-		TIMEMEASURE_END_MILLI(run);
+		startup_phase("sceneLoad", [&]() { scene_manager->loadScene(config.default_scene); });
+		startup_phase("sceneInit", [&]() {
+			scene_manager->setScene(config.default_scene);
+
+			registerIdleTasks();
+		});
+
+		const dur_milli_t run_total = std::chrono::steady_clock::now() - run_start;
+
+		std::string phase_summary;
+		for (const auto& [name, time] : startup_phases)
+		{
+			phase_summary +=
+				std::format("{}{} {:.3f}ms", phase_summary.empty() ? "" : ", ", name, time);
+
+			frame_stats.setCounter(std::format("startup.{}Ms", name), time);
+		}
 
 		this->logger->logSingle<decltype(this)>(
 			Logging::LogLevel::Info,
-			"Initialized in {:.3f}ms",
-			run_total.count()
+			"Initialized in {:.3f}ms ({})",
+			run_total.count(),
+			phase_summary
 		);
 
 		engineLoop();
@@ -529,6 +1291,109 @@ namespace Engine
 		vk_instance->getWindow()->setShouldClose(true);
 	}
 
+	void Engine::syncRenderThread()
+	{
+		if (render_thread) { render_thread->waitIdle(); }
+	}
+
+	void Engine::writeTrace(const std::string& path)
+	{
+#if !defined(CMEP_ENABLE_PROFILING)
+		this->logger->logSingle<decltype(this)>(
+			Logging::LogLevel::Warning,
+			"Profiling is compiled out, trace '{}' will contain no zones",
+			path
+		);
+#endif
+
+		try
+		{
+			const size_t zone_count =
+				Base::Profiling::writeChromeTrace(path, config.profiling.trace_frames);
+
+			this->logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Info,
+				"Wrote {} zones to trace '{}'",
+				zone_count,
+				path
+			);
+		}
+		catch (const std::exception& e)
+		{
+			this->logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Exception,
+				"Caught exception writing trace! e.what(): {}",
+				Base::unrollExceptions(e)
+			);
+		}
+	}
+
+	void Engine::updateStatCounters()
+	{
+		frame_stats.setCounter(
+			"peakMemoryBytes",
+			static_cast<double>(Base::Profiling::getPeakResidentMemory())
+		);
+		frame_stats.setCounter(
+			"pipelinesCreated",
+			static_cast<double>(pipeline_manager->getCreatedCount())
+		);
+
+		const auto job_stats = job_system->getStats();
+		frame_stats.setCounter("jobsExecuted", static_cast<double>(job_stats.executed));
+		frame_stats.setCounter("jobsStolen", static_cast<double>(job_stats.stolen));
+
+		frame_stats.setCounter("drawsCulled", static_cast<double>(frustum_culler.getCulledCount()));
+		frame_stats.setCounter("drawCalls", static_cast<double>(render_stats.draws));
+		frame_stats.setCounter("pipelineBinds", static_cast<double>(render_stats.pipeline_binds));
+		frame_stats.setCounter(
+			"deletionsPending",
+			static_cast<double>(vk_instance->getDeletionQueue()->getPendingCount())
+		);
+
+		// Per-scene estimates, the sum is what the scene memory budget is compared against
+		MemoryUsage scene_total;
+		for (const auto& entry : scene_manager->getMemoryReport())
+		{
+			frame_stats.setCounter(
+				std::format("scene.{}.cpuBytes", entry.name),
+				static_cast<double>(entry.usage.cpu_bytes)
+			);
+			frame_stats.setCounter(
+				std::format("scene.{}.gpuBytes", entry.name),
+				static_cast<double>(entry.usage.gpu_bytes)
+			);
+			scene_total += entry.usage;
+		}
+		frame_stats.setCounter("scenesCpuBytes", static_cast<double>(scene_total.cpu_bytes));
+		frame_stats.setCounter("scenesGpuBytes", static_cast<double>(scene_total.gpu_bytes));
+	}
+
+	void Engine::writeFrameStats(const std::string& path)
+	{
+		updateStatCounters();
+
+		try
+		{
+			writeTextFile(path, frame_stats.toJson());
+
+			this->logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Info,
+				"Wrote statistics of {} frames to '{}'",
+				frame_stats.getFrameCount(),
+				path
+			);
+		}
+		catch (const std::exception& e)
+		{
+			this->logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Exception,
+				"Caught exception writing frame statistics! e.what(): {}",
+				Base::unrollExceptions(e)
+			);
+		}
+	}
+
 	void Engine::configFile(std::string path)
 	{
 		config_path = std::move(path);
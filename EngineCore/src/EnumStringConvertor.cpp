@@ -5,6 +5,8 @@
 #include "Factories/ObjectFactory.hpp"
 
 #include "EventHandling.hpp"
+#include "FrameStats.hpp"
+#include "SpatialIndex.hpp"
 
 namespace Engine
 {
@@ -17,7 +19,27 @@ namespace Engine
 			{"on_mouse_moved"sv, value_t::onMouseMoved},
 			{"on_key_down"sv, value_t::onKeyDown},
 			{"on_key_up"sv, value_t::onKeyUp},
+			{"on_input"sv, value_t::onInput},
 			{"on_update"sv, value_t::onUpdate},
+			{"on_fixed_update"sv, value_t::onFixedUpdate},
+			{"on_scene_loaded"sv, value_t::onSceneLoaded},
+	};
+
+	template <>
+	EnumStringConvertor<FrameStats::Metric>::map_t
+		EnumStringConvertor<FrameStats::Metric>::value_map = {
+			{"frame"sv, value_t::frame},
+			{"work"sv, value_t::work},
+			{"event"sv, value_t::event},
+			{"draw"sv, value_t::draw},
+			{"poll"sv, value_t::poll},
+	};
+
+	template <>
+	EnumStringConvertor<SpatialIndex::Space>::map_t
+		EnumStringConvertor<SpatialIndex::Space>::value_map = {
+			{"world"sv, value_t::world},
+			{"screen"sv, value_t::screen},
 	};
 
 	using namespace Factories::ObjectFactory;
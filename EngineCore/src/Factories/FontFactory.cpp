@@ -7,6 +7,7 @@
 
 #include "Detail/KVPairHelper.hpp"
 #include "Exception.hpp"
+#include "Profiling.hpp"
 
 #include <array>
 #include <cassert>
@@ -100,6 +101,8 @@ namespace Engine::Factories
 		const pageload_callback_t&	 opt_callback
 	)
 	{
+		PROFILE_ZONE_CATEGORY("FontFactory::createFont", "asset");
+
 		std::ifstream font_file(font_path);
 
 		EXCEPTION_ASSERT(
@@ -2,6 +2,7 @@
 
 #include "Rendering/MeshBuilders/AxisMeshBuilder.hpp"
 #include "Rendering/MeshBuilders/GeneratorMeshBuilder.hpp"
+#include "Rendering/MeshBuilders/IMeshBuilder.hpp"
 #include "Rendering/MeshBuilders/SpriteMeshBuilder.hpp"
 #include "Rendering/MeshBuilders/TextMeshBuilder.hpp"
 #include "Rendering/Renderers/Renderer.hpp"
@@ -16,9 +17,26 @@
 #include <format>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Engine::Factories::ObjectFactory
 {
+	namespace
+	{
+		template <class meshbuilder_t>
+		Rendering::IMeshBuilder* constructMeshBuilder(
+			Engine*												 with_engine,
+			const std::vector<Rendering::MeshBuilderSupplyData>& meshbuilder_supply_data
+		)
+		{
+			auto* builder = new meshbuilder_t(with_engine);
+
+			for (const auto& supply : meshbuilder_supply_data) { builder->supplyData(supply); }
+
+			return builder;
+		}
+	} // namespace
+
 	object_factory_t getSceneObjectFactory(
 		EnumStringConvertor<RendererType>	 with_renderer,
 		EnumStringConvertor<MeshBuilderType> with_mesh_builder
@@ -111,6 +129,64 @@ namespace Engine::Factories::ObjectFactory
 		);
 	}
 
+	Rendering::IMeshBuilder* createMeshBuilder(
+		Engine*												 with_engine,
+		EnumStringConvertor<MeshBuilderType>				 with_mesh_builder,
+		const std::vector<Rendering::MeshBuilderSupplyData>& meshbuilder_supply_data
+	)
+	{
+		switch (with_mesh_builder)
+		{
+			case MeshBuilderType::SPRITE:
+			{
+				return constructMeshBuilder<Rendering::SpriteMeshBuilder>(
+					with_engine,
+					meshbuilder_supply_data
+				);
+			}
+			case MeshBuilderType::TEXT:
+			{
+				return constructMeshBuilder<Rendering::TextMeshBuilder>(
+					with_engine,
+					meshbuilder_supply_data
+				);
+			}
+			case MeshBuilderType::AXIS:
+			{
+				return constructMeshBuilder<Rendering::AxisMeshBuilder>(
+					with_engine,
+					meshbuilder_supply_data
+				);
+			}
+			case MeshBuilderType::GENERATOR:
+			{
+				return constructMeshBuilder<Rendering::GeneratorMeshBuilder>(
+					with_engine,
+					meshbuilder_supply_data
+				);
+			}
+			default:
+			{
+				throw ENGINE_EXCEPTION("Invalid mesh builder type!");
+			}
+		}
+	}
+
+	bool isMeshShareable(EnumStringConvertor<MeshBuilderType> with_mesh_builder)
+	{
+		switch (with_mesh_builder)
+		{
+			case MeshBuilderType::SPRITE:	 return Rendering::SpriteMeshBuilder::mesh_shareable;
+			case MeshBuilderType::TEXT:		 return Rendering::TextMeshBuilder::mesh_shareable;
+			case MeshBuilderType::AXIS:		 return Rendering::AxisMeshBuilder::mesh_shareable;
+			case MeshBuilderType::GENERATOR: return Rendering::GeneratorMeshBuilder::mesh_shareable;
+			default:
+			{
+				throw ENGINE_EXCEPTION("Invalid mesh builder type!");
+			}
+		}
+	}
+
 	Rendering::RendererSupplyData generateRendererSupplyData(
 		EnumStringConvertor<Rendering::RendererSupplyData::Type> of_type,
 		supply_data_value_t										 with_value
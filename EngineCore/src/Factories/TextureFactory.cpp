@@ -10,6 +10,7 @@
 #include "Engine.hpp"
 #include "Exception.hpp"
 #include "InternalEngineObject.hpp"
+#include "Profiling.hpp"
 
 #include <cassert>
 #include <cstddef>
@@ -18,7 +19,6 @@
 #include <filesystem>
 #include <format>
 #include <memory>
-#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -34,12 +34,11 @@ namespace Engine::Factories
 	 */
 	static constexpr size_t texture_size_limit = 0x2fff;
 
-	std::shared_ptr<Rendering::Texture> TextureFactory::createTexture(
-		const std::filesystem::path& path,
-		vk::Filter					 filtering,
-		vk::SamplerAddressMode		 sampler_address_mode
-	)
+	TextureFactory::DecodedImage TextureFactory::decodeImage(const std::filesystem::path& path
+	) const
 	{
+		PROFILE_ZONE_CATEGORY("TextureFactory::decodeImage", "asset");
+
 		if (!std::filesystem::exists(path))
 		{
 			throw ENGINE_EXCEPTION(std::format(
@@ -54,12 +53,8 @@ namespace Engine::Factories
 			path.lexically_normal().string()
 		);
 
-		std::vector<unsigned char>				data;
-		std::unique_ptr<Rendering::TextureData> texture_data =
-			std::make_unique<Rendering::TextureData>();
-
-		Rendering::ImageSize size;
-		unsigned int		 error;
+		DecodedImage image;
+		unsigned int error;
 
 		// lodepng uses references for output
 		// this makes it incompatible with ImageSize when defined with
@@ -68,26 +63,55 @@ namespace Engine::Factories
 			unsigned int size_x;
 			unsigned int size_y;
 
-			error = lodepng::decode(data, size_x, size_y, path.string());
-			size  = {size_x, size_y};
+			error	   = lodepng::decode(image.data, size_x, size_y, path.string());
+			image.size = {size_x, size_y};
 		}
 
-		if (error != 0 || 0 >= size.x || size.x >= texture_size_limit || 0 >= size.y ||
-			size.y >= texture_size_limit)
+		if (error != 0 || 0 >= image.size.x || image.size.x >= texture_size_limit ||
+			0 >= image.size.y || image.size.y >= texture_size_limit)
 		{
 			throw ENGINE_EXCEPTION("Failed decoding PNG file!");
 		}
 
 		this->logger->logSingle<decltype(this)>(
 			Logging::LogLevel::VerboseDebug,
-			"Decoded png file '{}'; width {}; height {}; filter {}",
+			"Decoded png file '{}'; width {}; height {}",
 			path.lexically_normal().string(),
-			size.x,
-			size.y,
-			static_cast<std::underlying_type_t<vk::Filter>>(filtering)
+			image.size.x,
+			image.size.y
 		);
 
-		createTextureInternal(texture_data, std::move(data), 4, filtering, sampler_address_mode, size);
+		return image;
+	}
+
+	std::shared_ptr<Rendering::Texture> TextureFactory::createTexture(
+		const std::filesystem::path& path,
+		vk::Filter					 filtering,
+		vk::SamplerAddressMode		 sampler_address_mode
+	)
+	{
+		return createTexture(decodeImage(path), filtering, sampler_address_mode);
+	}
+
+	std::shared_ptr<Rendering::Texture> TextureFactory::createTexture(
+		DecodedImage		   image,
+		vk::Filter			   filtering,
+		vk::SamplerAddressMode sampler_address_mode
+	)
+	{
+		PROFILE_ZONE_CATEGORY("TextureFactory::createTexture", "asset");
+
+		std::unique_ptr<Rendering::TextureData> texture_data =
+			std::make_unique<Rendering::TextureData>();
+
+		createTextureInternal(
+			texture_data,
+			std::move(image.data),
+			4,
+			filtering,
+			sampler_address_mode,
+			image.size
+		);
 
 		std::shared_ptr<Rendering::Texture> texture =
 			std::make_shared<Rendering::Texture>(owner_engine, std::move(texture_data));
@@ -117,7 +141,7 @@ namespace Engine::Factories
 
 		auto* logical_device = vk_instance->getLogicalDevice();
 
-		Rendering::Vulkan::StagingBuffer staging_buffer(
+		auto staging_buffer = std::make_unique<Rendering::Vulkan::StagingBuffer>(
 			logical_device,
 			vk_instance->getGraphicMemoryAllocator(),
 			raw_data.data(),
@@ -141,37 +165,45 @@ namespace Engine::Factories
 			vk_instance->getPhysicalDevice()->getLimits().maxSamplerAnisotropy
 		);
 
+		auto* command_buffer = vk_instance->getCommandPool()->allocateCommandBuffer();
+
 		try
 		{
-			auto command_buffer = vk_instance->getCommandPool()->constructCommandBuffer();
-
-			command_buffer.beginOneTime();
+			command_buffer->beginOneTime();
 
 			// Transfer image layout to compatible with transfers
 			texture_data->image->transitionImageLayout(
-				command_buffer,
+				*command_buffer,
 				vk::ImageLayout::eTransferDstOptimal
 			);
 
-			command_buffer.copyBufferImage(&staging_buffer, texture_data->image);
+			command_buffer->copyBufferImage(staging_buffer.get(), texture_data->image);
 
 			// Transfer image layout to compatible with rendering
 			texture_data->image->transitionImageLayout(
-				command_buffer,
+				*command_buffer,
 				vk::ImageLayout::eShaderReadOnlyOptimal
 			);
 
-			command_buffer.end();
+			command_buffer->end();
 
-			command_buffer.queueSubmit(logical_device->getGraphicsQueue());
+			// Frames submitted later are ordered after the upload by the layout transition,
+			// so there is no need to wait for it
+			command_buffer->queueSubmitAsync(logical_device->getGraphicsQueue());
 		}
 		catch (...)
 		{
+			delete command_buffer;
+
 			std::throw_with_nested(
 				ENGINE_EXCEPTION("Exception caught trying to fill and transition texture")
 			);
 		}
 
+		auto* deletion_queue = vk_instance->getDeletionQueue();
+		deletion_queue->retire(command_buffer);
+		deletion_queue->retire(std::move(staging_buffer));
+
 		return 0;
 	}
 } // namespace Engine::Factories
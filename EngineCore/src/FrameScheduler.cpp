@@ -0,0 +1,165 @@
+#include "FrameScheduler.hpp"
+
+#include "Exception.hpp"
+#include "Profiling.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Engine
+{
+#pragma region Internal static
+
+	namespace
+	{
+		using namespace std::chrono_literals;
+
+		// Do not start an idle task with less time than this left
+		constexpr auto min_task_budget = 100us;
+
+		// Bounds of the oversleep estimate
+		constexpr auto max_oversleep = 2ms;
+
+		// Shorter sleeps aren't worth the wakeup, the frame ends this much early at most
+		constexpr auto min_sleep = 50us;
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+	void FrameScheduler::addIdleTask(const std::string& name, idle_task_t task)
+	{
+		EXCEPTION_ASSERT(
+			std::none_of(
+				tasks.begin(),
+				tasks.end(),
+				[&](const IdleTask& other) { return other.name == name; }
+			),
+			"Idle task already exists!"
+		);
+
+		tasks.push_back(
+			{.name		= name,
+			 .zone_name = Base::Profiling::internName(name),
+			 .callback	= std::move(task),
+			 .pending	= true}
+		);
+	}
+
+	void FrameScheduler::removeIdleTask(const std::string& name)
+	{
+		std::erase_if(tasks, [&](const IdleTask& task) { return task.name == name; });
+		next_task = 0;
+	}
+
+	void FrameScheduler::waitUntil(clock_t::time_point deadline)
+	{
+		const auto start = clock_t::now();
+
+		last_stats = {};
+
+		// Frame overran its budget, nothing to do
+		if (start >= deadline)
+		{
+			frame_count++;
+			return;
+		}
+
+		runIdleTasks(deadline - oversleep_estimate);
+
+		const auto tasks_end = clock_t::now();
+
+		wait(deadline);
+
+		using dur_milli_t = std::chrono::duration<double, std::milli>;
+
+		last_stats.slack_ms	   = dur_milli_t(deadline - start).count();
+		last_stats.task_ms	   = dur_milli_t(tasks_end - start).count();
+		last_stats.utilisation = std::min(last_stats.task_ms / last_stats.slack_ms, 1.0);
+
+		utilisation_sum += last_stats.utilisation;
+		frame_count++;
+	}
+
+#pragma endregion
+
+#pragma region Private
+
+	void FrameScheduler::runIdleTasks(clock_t::time_point task_deadline)
+	{
+		if (tasks.empty()) { return; }
+
+		PROFILE_ZONE("FrameScheduler::runIdleTasks");
+
+		for (auto& task : tasks) { task.pending = true; }
+
+		size_t idle_count = 0;
+		while (idle_count < tasks.size())
+		{
+			const auto budget = task_deadline - clock_t::now();
+			if (budget < min_task_budget) { break; }
+
+			auto& task = tasks[next_task];
+			next_task  = (next_task + 1) % tasks.size();
+
+			if (!task.pending)
+			{
+				idle_count++;
+				continue;
+			}
+			idle_count = 0;
+
+			{
+				PROFILE_ZONE_CATEGORY(task.zone_name, "idle");
+				task.pending = task.callback(budget);
+			}
+
+			last_stats.task_calls++;
+		}
+	}
+
+	void FrameScheduler::wait(clock_t::time_point deadline)
+	{
+		PROFILE_ZONE("FrameScheduler::wait");
+
+		// Sleep until shortly before the deadline,
+		// waking up too early is fine but oversleeping delays the next frame
+		const auto sleep_target = deadline - oversleep_estimate;
+		if (clock_t::now() < sleep_target)
+		{
+			std::this_thread::sleep_until(sleep_target);
+
+			const auto oversleep = clock_t::now() - sleep_target;
+
+			// Grow the estimate quickly but let it decay slowly,
+			// so that occasional late wakeups are accounted for
+			if (oversleep > oversleep_estimate)
+			{
+				oversleep_estimate = (oversleep_estimate + oversleep) / 2;
+			}
+			else { oversleep_estimate = (oversleep_estimate * 15 + oversleep) / 16; }
+
+			oversleep_estimate = std::clamp<clock_t::duration>(
+				oversleep_estimate,
+				clock_t::duration::zero(),
+				max_oversleep
+			);
+		}
+
+		// Cover the remaining fraction of a millisecond with sleeps of half the time left,
+		// short sleeps wake up close to on time and leave the core to other threads
+		auto remaining = deadline - clock_t::now();
+		while (remaining > min_sleep)
+		{
+			std::this_thread::sleep_for(remaining / 2);
+			remaining = deadline - clock_t::now();
+		}
+	}
+
+#pragma endregion
+} // namespace Engine
@@ -0,0 +1,135 @@
+#include "FrameStats.hpp"
+
+#include "EnumStringConvertor.hpp"
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Engine
+{
+#pragma region Internal static
+
+	namespace
+	{
+		/**
+		 * Get the value at @p percentile of sorted @p values using the nearest-rank method
+		 */
+		double percentileOfSorted(const std::vector<double>& values, double percentile)
+		{
+			const auto rank = static_cast<size_t>(
+				std::ceil(percentile / 100.0 * static_cast<double>(values.size()))
+			);
+
+			return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+		}
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+	FrameStats::FrameStats(double with_budget_ms) : budget_ms(with_budget_ms) {}
+
+	void FrameStats::record(double frame_ms, double event_ms, double draw_ms, double poll_ms)
+	{
+		const double work_ms = event_ms + draw_ms + poll_ms;
+
+		const std::array<double, metric_count> values = {
+			frame_ms,
+			work_ms,
+			event_ms,
+			draw_ms,
+			poll_ms
+		};
+
+		for (size_t metric = 0; metric < metric_count; metric++)
+		{
+			samples[metric][next_sample] = values[metric];
+		}
+
+		next_sample = (next_sample + 1) % history_size;
+
+		if (work_ms > budget_ms) { over_budget_count++; }
+		frame_count++;
+	}
+
+	FrameStats::Summary FrameStats::getSummary(Metric metric) const
+	{
+		const size_t sample_count = getSampleCount();
+		if (sample_count == 0) { return {}; }
+
+		const auto& metric_samples = samples[static_cast<size_t>(metric)];
+
+		// Samples past sample_count are unused until the ring buffer first wraps
+		std::vector<double> sorted(metric_samples.begin(), metric_samples.begin() + sample_count);
+		std::sort(sorted.begin(), sorted.end());
+
+		return {
+			.p50  = percentileOfSorted(sorted, 50.0),
+			.p95  = percentileOfSorted(sorted, 95.0),
+			.p99  = percentileOfSorted(sorted, 99.0),
+			.max  = sorted.back(),
+			.mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) /
+					static_cast<double>(sample_count)
+		};
+	}
+
+	FrameStats::histogram_t FrameStats::getHistogram() const
+	{
+		histogram_t histogram{};
+
+		const double bucket_width = budget_ms / 8.0;
+		if (bucket_width <= 0.0) { return histogram; }
+
+		const auto& work_samples = samples[static_cast<size_t>(Metric::work)];
+
+		for (size_t idx = 0; idx < getSampleCount(); idx++)
+		{
+			const auto bucket = static_cast<size_t>(work_samples[idx] / bucket_width);
+			histogram[std::min(bucket, histogram_bucket_count - 1)]++;
+		}
+
+		return histogram;
+	}
+
+	std::string FrameStats::toJson() const
+	{
+		nlohmann::json data = {
+			{"frames", frame_count},
+			{"samples", getSampleCount()},
+			{"budgetMs", budget_ms},
+			{"overBudget", over_budget_count},
+			{"histogram", getHistogram()},
+			{"counters", counters},
+		};
+
+		for (size_t metric = 0; metric < metric_count; metric++)
+		{
+			const auto value = static_cast<Metric>(metric);
+
+			const Summary	 summary = getSummary(value);
+			std::string_view name	 = EnumStringConvertor<Metric>(value);
+
+			data["metrics"][std::string(name)] = {
+				{"p50", summary.p50},
+				{"p95", summary.p95},
+				{"p99", summary.p99},
+				{"max", summary.max},
+				{"mean", summary.mean},
+			};
+		}
+
+		return data.dump(4);
+	}
+
+#pragma endregion
+} // namespace Engine
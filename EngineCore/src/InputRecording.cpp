@@ -0,0 +1,147 @@
+#include "InputRecording.hpp"
+
+#include "EventHandling.hpp"
+#include "Exception.hpp"
+#include "nlohmann/json.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+namespace Engine
+{
+#pragma region Internal static
+
+	namespace
+	{
+		constexpr int recording_version = 1;
+
+		using input_type_t = std::underlying_type_t<EventHandling::InputEvent::Type>;
+
+		/*
+		 * Inputs are stored as compact arrays to keep long sessions small,
+		 * [type, keycode] for key events and [type, x, y] for mouse movement
+		 */
+
+		nlohmann::json serializeInput(const EventHandling::InputEvent& input)
+		{
+			const auto type = static_cast<input_type_t>(input.type);
+
+			if (input.type == EventHandling::InputEvent::Type::mouseMoved)
+			{
+				return nlohmann::json::array({type, input.mouse.x, input.mouse.y});
+			}
+
+			return nlohmann::json::array({type, input.keycode});
+		}
+
+		EventHandling::InputEvent deserializeInput(const nlohmann::json& data)
+		{
+			EventHandling::InputEvent input{
+				.type = static_cast<EventHandling::InputEvent::Type>(data.at(0).get<input_type_t>())
+			};
+
+			switch (input.type)
+			{
+				case EventHandling::InputEvent::Type::keyDown:
+				case EventHandling::InputEvent::Type::keyUp:
+				{
+					input.keycode = data.at(1).get<uint16_t>();
+					break;
+				}
+				case EventHandling::InputEvent::Type::mouseMoved:
+				{
+					input.mouse = {data.at(1).get<double>(), data.at(2).get<double>()};
+					break;
+				}
+				default:
+				{
+					throw ENGINE_EXCEPTION("Unknown input event!");
+				}
+			}
+
+			return input;
+		}
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+	InputRecording InputRecording::load(const std::string& path)
+	{
+		std::ifstream file(path);
+		if (!file.is_open())
+		{
+			throw ENGINE_EXCEPTION(std::format("Could not open input recording '{}'", path));
+		}
+
+		InputRecording recording;
+
+		try
+		{
+			const auto data = nlohmann::json::parse(file);
+
+			EXCEPTION_ASSERT(
+				data.at("version").get<int>() == recording_version,
+				"Unsupported input recording version!"
+			);
+
+			recording.seed = data.at("seed").get<uint32_t>();
+
+			const auto& frames = data.at("frames");
+			recording.frames.reserve(frames.size());
+
+			for (const auto& frame_data : frames)
+			{
+				auto& frame		 = recording.frames.emplace_back();
+				frame.delta_time = frame_data.at(0).get<double>();
+
+				for (const auto& input : frame_data.at(1))
+				{
+					frame.inputs.push_back(deserializeInput(input));
+				}
+			}
+		}
+		catch (...)
+		{
+			std::throw_with_nested(
+				ENGINE_EXCEPTION(std::format("Exception parsing input recording '{}'!", path))
+			);
+		}
+
+		return recording;
+	}
+
+	void InputRecording::save(const std::string& path) const
+	{
+		nlohmann::json frames = nlohmann::json::array();
+
+		for (const auto& frame : this->frames)
+		{
+			nlohmann::json inputs = nlohmann::json::array();
+			for (const auto& input : frame.inputs) { inputs.push_back(serializeInput(input)); }
+
+			frames.push_back(nlohmann::json::array({frame.delta_time, std::move(inputs)}));
+		}
+
+		const nlohmann::json data = {
+			{"version", recording_version},
+			{"seed", seed},
+			{"frames", std::move(frames)},
+		};
+
+		std::ofstream file(path, std::ios::trunc);
+		if (!file.is_open())
+		{
+			throw ENGINE_EXCEPTION(std::format("Could not open input recording '{}'", path));
+		}
+
+		file << data.dump();
+	}
+
+#pragma endregion
+} // namespace Engine
@@ -0,0 +1,383 @@
+#include "ObjectStorage.hpp"
+
+#include "Rendering/Bounds.hpp"
+#include "Rendering/MeshBuilders/MeshBuildContext.hpp"
+#include "Rendering/Renderers/Renderer.hpp"
+#include "Rendering/Transform.hpp"
+
+#include "Exception.hpp"
+#include "SceneObject.hpp"
+#include "SpatialIndex.hpp"
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/quaternion.hpp"
+#include "glm/mat4x4.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <utility>
+
+namespace Engine
+{
+#pragma region Internal static
+
+	namespace
+	{
+		[[nodiscard]] glm::quat eulerToQuat(const glm::vec3& rotation)
+		{
+			return glm::quat(glm::radians(rotation));
+		}
+
+		/**
+		 * Calculate the model matrix of an object relative to its parent
+		 *
+		 * model = parent * position * rotation * scale
+		 */
+		[[nodiscard]] glm::mat4 calculateModelMatrix(
+			const glm::mat4& parent,
+			const glm::vec3& position,
+			const glm::quat& rotation,
+			const glm::vec3& size
+		)
+		{
+			const auto translated = glm::translate(parent, position);
+			const auto rotated	  = translated * glm::mat4_cast(rotation);
+
+			return glm::scale(rotated, size);
+		}
+
+		[[nodiscard]] SpatialIndex::Space getSpace(const Rendering::IRenderer* renderer)
+		{
+			if (renderer != nullptr &&
+				renderer->getProjectionType() == Rendering::ProjectionType::ortho)
+			{
+				return SpatialIndex::Space::screen;
+			}
+			return SpatialIndex::Space::world;
+		}
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+	ObjectHandle ObjectStorage::insert(const std::string& name, SceneObject* object)
+	{
+		EXCEPTION_ASSERT(object != nullptr, "Cannot store nullptr object!");
+		EXCEPTION_ASSERT(object->storage == nullptr, "Object is already stored in a scene!");
+
+		if (name_index.contains(name))
+		{
+			throw ENGINE_EXCEPTION(std::format("Object with name '{}' already exists!", name));
+		}
+
+		uint32_t slot_index;
+		if (!free_slots.empty())
+		{
+			slot_index = free_slots.back();
+			free_slots.pop_back();
+		}
+		else
+		{
+			slot_index = static_cast<uint32_t>(slots.size());
+			slots.emplace_back();
+		}
+
+		auto& slot		 = slots[slot_index];
+		slot.dense_index = static_cast<uint32_t>(objects.size());
+
+		const ObjectHandle handle = {.index = slot_index, .generation = slot.generation};
+
+		objects.push_back(object);
+		renderers.push_back(object->getRenderer());
+		names.push_back(name);
+		positions.push_back(object->transform.pos);
+		sizes.push_back(object->transform.size);
+		rotations.push_back(object->transform.rotation);
+		local_rotations.push_back(eulerToQuat(object->transform.rotation));
+		world_matrices.push_back(glm::identity<glm::mat4>());
+		world_bounds.emplace_back();
+		dirty.push_back(0);
+		mesh_revisions.push_back(0);
+		dense_slots.push_back(slot_index);
+
+		name_index.emplace(name, handle);
+
+		object->storage = this;
+		object->handle	= handle;
+
+		markDirtyDense(slot.dense_index);
+
+		return handle;
+	}
+
+	SceneObject* ObjectStorage::erase(ObjectHandle handle)
+	{
+		const uint32_t dense_index = getDenseIndex(handle);
+		if (dense_index == ObjectHandle::invalid_index) { return nullptr; }
+
+		SceneObject* object = objects[dense_index];
+
+		// Hand the transform back to the object
+		object->transform = {
+			.pos	  = positions[dense_index],
+			.size	  = sizes[dense_index],
+			.rotation = rotations[dense_index]
+		};
+		object->storage = nullptr;
+		object->handle	= {};
+
+		name_index.erase(names[dense_index]);
+		spatial_index.remove(handle);
+
+		// Move the last element into the hole
+		const auto last_index = static_cast<uint32_t>(objects.size() - 1);
+		if (dense_index != last_index)
+		{
+			objects[dense_index]		 = objects[last_index];
+			renderers[dense_index]		 = renderers[last_index];
+			names[dense_index]			 = std::move(names[last_index]);
+			positions[dense_index]		 = positions[last_index];
+			sizes[dense_index]			 = sizes[last_index];
+			rotations[dense_index]		 = rotations[last_index];
+			local_rotations[dense_index] = local_rotations[last_index];
+			world_matrices[dense_index]	 = world_matrices[last_index];
+			world_bounds[dense_index]	 = world_bounds[last_index];
+			dirty[dense_index]			 = dirty[last_index];
+			mesh_revisions[dense_index]	 = mesh_revisions[last_index];
+			dense_slots[dense_index]	 = dense_slots[last_index];
+
+			slots[dense_slots[dense_index]].dense_index = dense_index;
+		}
+
+		objects.pop_back();
+		renderers.pop_back();
+		names.pop_back();
+		positions.pop_back();
+		sizes.pop_back();
+		rotations.pop_back();
+		local_rotations.pop_back();
+		world_matrices.pop_back();
+		world_bounds.pop_back();
+		dirty.pop_back();
+		mesh_revisions.pop_back();
+		dense_slots.pop_back();
+
+		// Invalidate outstanding handles to this slot
+		auto& slot		 = slots[handle.index];
+		slot.generation	 = (slot.generation + 1) & ObjectHandle::generation_mask;
+		slot.dense_index = ObjectHandle::invalid_index;
+		free_slots.push_back(handle.index);
+
+		return object;
+	}
+
+	SceneObject* ObjectStorage::get(ObjectHandle handle) const noexcept
+	{
+		const uint32_t dense_index = getDenseIndex(handle);
+		if (dense_index == ObjectHandle::invalid_index) { return nullptr; }
+
+		return objects[dense_index];
+	}
+
+	ObjectHandle ObjectStorage::find(const std::string& name) const noexcept
+	{
+		auto found = name_index.find(name);
+		if (found != name_index.end()) { return found->second; }
+		return {};
+	}
+
+	Rendering::Transform ObjectStorage::getTransform(ObjectHandle handle) const
+	{
+		const uint32_t dense_index = getDenseIndexChecked(handle);
+
+		return {
+			.pos	  = positions[dense_index],
+			.size	  = sizes[dense_index],
+			.rotation = rotations[dense_index]
+		};
+	}
+
+	void ObjectStorage::setPosition(ObjectHandle handle, const glm::vec3& position)
+	{
+		const uint32_t dense_index = getDenseIndexChecked(handle);
+
+		positions[dense_index] = position;
+		markDirtyDense(dense_index);
+	}
+
+	void ObjectStorage::setSize(ObjectHandle handle, const glm::vec3& size)
+	{
+		const uint32_t dense_index = getDenseIndexChecked(handle);
+
+		sizes[dense_index] = size;
+		markDirtyDense(dense_index);
+	}
+
+	void ObjectStorage::setRotation(ObjectHandle handle, const glm::vec3& rotation)
+	{
+		const uint32_t dense_index = getDenseIndexChecked(handle);
+
+		rotations[dense_index]		 = rotation;
+		local_rotations[dense_index] = eulerToQuat(rotation);
+		markDirtyDense(dense_index);
+	}
+
+	void ObjectStorage::markDirty(ObjectHandle handle)
+	{
+		markDirtyDense(getDenseIndexChecked(handle));
+	}
+
+	size_t ObjectStorage::updateTransforms()
+	{
+		size_t updated_count = 0;
+
+		for (const ObjectHandle handle : dirty_list)
+		{
+			const uint32_t dense_index = getDenseIndex(handle);
+
+			// Removed since, or already recomputed as part of a dirty ancestor's subtree
+			if (dense_index == ObjectHandle::invalid_index || dirty[dense_index] == 0) { continue; }
+
+			// Start from the topmost dirty ancestor so that every subtree is only walked once
+			SceneObject* root	  = objects[dense_index];
+			SceneObject* ancestor = root->parent;
+			while (ancestor != nullptr)
+			{
+				if (ancestor->storage == this && dirty[getDenseIndex(ancestor->handle)] != 0)
+				{
+					root = ancestor;
+				}
+				ancestor = ancestor->parent;
+			}
+
+			updated_count += updateSubtree(root);
+		}
+
+		dirty_list.clear();
+
+		return updated_count;
+	}
+
+	void ObjectStorage::updateMeshBounds()
+	{
+		for (uint32_t dense_index = 0; dense_index < renderers.size(); dense_index++)
+		{
+			const Rendering::IRenderer* renderer = renderers[dense_index];
+			if (renderer == nullptr) { continue; }
+
+			if (renderer->getMeshContext().revision != mesh_revisions[dense_index])
+			{
+				updateBounds(dense_index);
+			}
+		}
+	}
+
+#pragma endregion
+
+#pragma region Private
+
+	uint32_t ObjectStorage::getDenseIndex(ObjectHandle handle) const noexcept
+	{
+		if (handle.index >= slots.size()) { return ObjectHandle::invalid_index; }
+
+		const auto& slot = slots[handle.index];
+		if (slot.generation != handle.generation) { return ObjectHandle::invalid_index; }
+
+		return slot.dense_index;
+	}
+
+	uint32_t ObjectStorage::getDenseIndexChecked(ObjectHandle handle) const
+	{
+		const uint32_t dense_index = getDenseIndex(handle);
+		EXCEPTION_ASSERT(dense_index != ObjectHandle::invalid_index, "Stale object handle!");
+
+		return dense_index;
+	}
+
+	void ObjectStorage::markDirtyDense(uint32_t dense_index)
+	{
+		if (dirty[dense_index] != 0) { return; }
+
+		dirty[dense_index] = 1;
+		dirty_list.push_back({
+			.index		= dense_slots[dense_index],
+			.generation = slots[dense_slots[dense_index]].generation
+		});
+	}
+
+	size_t ObjectStorage::updateSubtree(SceneObject* root)
+	{
+		size_t updated_count = 0;
+
+		update_stack.clear();
+		update_stack.push_back(root);
+
+		// Depth-first, an object's world matrix is always written before its children are visited
+		while (!update_stack.empty())
+		{
+			SceneObject* object = update_stack.back();
+			update_stack.pop_back();
+
+			const uint32_t dense_index = getDenseIndex(object->handle);
+
+			const SceneObject* parent = object->parent;
+
+			glm::mat4 parent_matrix = glm::identity<glm::mat4>();
+			if (parent != nullptr && parent->storage == this)
+			{
+				parent_matrix = world_matrices[getDenseIndex(parent->handle)];
+			}
+
+			world_matrices[dense_index] = calculateModelMatrix(
+				parent_matrix,
+				positions[dense_index],
+				local_rotations[dense_index],
+				sizes[dense_index]
+			);
+			dirty[dense_index] = 0;
+
+			if (renderers[dense_index] != nullptr)
+			{
+				renderers[dense_index]->updateWorldMatrix(world_matrices[dense_index]);
+			}
+			updateBounds(dense_index);
+			updated_count++;
+
+			for (SceneObject* child : object->children)
+			{
+				if (child->storage == this) { update_stack.push_back(child); }
+			}
+		}
+
+		return updated_count;
+	}
+
+	void ObjectStorage::updateBounds(uint32_t dense_index)
+	{
+		const Rendering::IRenderer* renderer = renderers[dense_index];
+		const glm::mat4&			world	 = world_matrices[dense_index];
+
+		// Objects without a mesh are found by their origin
+		Rendering::AABB local_bounds = {};
+		if (renderer != nullptr)
+		{
+			const auto& context = renderer->getMeshContext();
+			if (context.vbo_vert_count > 0) { local_bounds = context.bounds; }
+
+			mesh_revisions[dense_index] = context.revision;
+		}
+
+		world_bounds[dense_index] = local_bounds.transformed(world);
+
+		const uint32_t slot_index = dense_slots[dense_index];
+		spatial_index.update(
+			{.index = slot_index, .generation = slots[slot_index].generation},
+			getSpace(renderer),
+			world_bounds[dense_index]
+		);
+	}
+
+#pragma endregion
+} // namespace Engine
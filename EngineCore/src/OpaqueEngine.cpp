@@ -2,6 +2,7 @@
 
 #include "Engine.hpp"
 
+#include <cstdint>
 #include <memory>
 
 namespace Engine
@@ -30,4 +31,23 @@ namespace Engine
 	{
 		d_engine->configFile(path);
 	}
+
+	void OpaqueEngine::setHeadless(uint64_t frame_limit, double time_limit)
+	{
+		d_engine->setHeadless({
+			.enabled	 = true,
+			.frame_limit = frame_limit,
+			.time_limit	 = time_limit,
+		});
+	}
+
+	void OpaqueEngine::recordInput(const char* path)
+	{
+		d_engine->recordInput(path);
+	}
+
+	void OpaqueEngine::replayInput(const char* path)
+	{
+		d_engine->replayInput(path);
+	}
 } // namespace Engine
@@ -0,0 +1,231 @@
+#include "Rendering/FrustumCuller.hpp"
+
+#include "Rendering/Bounds.hpp"
+#include "Rendering/MeshBuilders/MeshBuildContext.hpp"
+#include "Rendering/Renderers/Renderer.hpp"
+#include "Rendering/Vulkan/common.hpp"
+
+#include "glm/common.hpp"
+#include "glm/mat4x4.hpp"
+#include "glm/vec3.hpp"
+#include "glm/vec4.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	define CMEP_CULLING_SSE
+#	include <xmmintrin.h>
+#endif
+
+namespace Engine::Rendering
+{
+#pragma region Internal static
+
+	namespace
+	{
+		[[nodiscard]] glm::vec4 getRow(const glm::mat4& matrix, int row)
+		{
+			return {matrix[0][row], matrix[1][row], matrix[2][row], matrix[3][row]};
+		}
+
+		/**
+		 * Test boxes against all planes of a frustum
+		 *
+		 * A box is outside if it lies entirely behind any one plane,
+		 * planes need not be normalized since only the sign of the distance matters.
+		 *
+		 * @param[in]  frustum Frustum to test against
+		 * @param[in]  bounds  Boxes to test
+		 * @param[out] results Receives 1 for every box that may be visible, 0 otherwise
+		 */
+		template <typename packed_bounds_t>
+		void testBounds(
+			const Frustum&		   frustum,
+			const packed_bounds_t& bounds,
+			std::vector<uint8_t>&  results
+		)
+		{
+			const size_t count = bounds.indices.size();
+			results.resize(count);
+
+			// Absolute normals are shared by all boxes
+			std::array<glm::vec3, 6> abs_normals;
+			for (size_t plane = 0; plane < frustum.planes.size(); plane++)
+			{
+				abs_normals[plane] = glm::abs(glm::vec3(frustum.planes[plane]));
+			}
+
+			size_t idx = 0;
+
+#ifdef CMEP_CULLING_SSE
+			const __m128 zero = _mm_setzero_ps();
+
+			// Four boxes per iteration
+			for (; idx + 4 <= count; idx += 4)
+			{
+				const __m128 center_x = _mm_loadu_ps(&bounds.center_x[idx]);
+				const __m128 center_y = _mm_loadu_ps(&bounds.center_y[idx]);
+				const __m128 center_z = _mm_loadu_ps(&bounds.center_z[idx]);
+				const __m128 extent_x = _mm_loadu_ps(&bounds.extent_x[idx]);
+				const __m128 extent_y = _mm_loadu_ps(&bounds.extent_y[idx]);
+				const __m128 extent_z = _mm_loadu_ps(&bounds.extent_z[idx]);
+
+				__m128 inside = _mm_cmpeq_ps(zero, zero);
+
+				for (size_t plane = 0; plane < frustum.planes.size(); plane++)
+				{
+					const glm::vec4& normal		= frustum.planes[plane];
+					const glm::vec3& abs_normal = abs_normals[plane];
+
+					// distance = n . center + w
+					__m128 distance = _mm_mul_ps(center_x, _mm_set1_ps(normal.x));
+					distance = _mm_add_ps(distance, _mm_mul_ps(center_y, _mm_set1_ps(normal.y)));
+					distance = _mm_add_ps(distance, _mm_mul_ps(center_z, _mm_set1_ps(normal.z)));
+					distance = _mm_add_ps(distance, _mm_set1_ps(normal.w));
+
+					// radius = |n| . extent
+					__m128 radius = _mm_mul_ps(extent_x, _mm_set1_ps(abs_normal.x));
+					radius = _mm_add_ps(radius, _mm_mul_ps(extent_y, _mm_set1_ps(abs_normal.y)));
+					radius = _mm_add_ps(radius, _mm_mul_ps(extent_z, _mm_set1_ps(abs_normal.z)));
+
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, radius), zero));
+				}
+
+				const int mask = _mm_movemask_ps(inside);
+				for (size_t lane = 0; lane < 4; lane++)
+				{
+					results[idx + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+				}
+			}
+#endif
+
+			// Remaining boxes (or all without SSE)
+			for (; idx < count; idx++)
+			{
+				const glm::vec3 center =
+					{bounds.center_x[idx], bounds.center_y[idx], bounds.center_z[idx]};
+				const glm::vec3 extent =
+					{bounds.extent_x[idx], bounds.extent_y[idx], bounds.extent_z[idx]};
+
+				bool inside = true;
+				for (size_t plane = 0; plane < frustum.planes.size(); plane++)
+				{
+					const float distance = glm::dot(glm::vec3(frustum.planes[plane]), center) +
+										   frustum.planes[plane].w;
+					const float radius	 = glm::dot(abs_normals[plane], extent);
+
+					inside = inside && (distance + radius >= 0.0f);
+				}
+
+				results[idx] = static_cast<uint8_t>(inside);
+			}
+		}
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+	Frustum Frustum::fromMatrix(const glm::mat4& view_projection)
+	{
+		const glm::vec4 row_x = getRow(view_projection, 0);
+		const glm::vec4 row_y = getRow(view_projection, 1);
+		const glm::vec4 row_z = getRow(view_projection, 2);
+		const glm::vec4 row_w = getRow(view_projection, 3);
+
+		// Near plane assumes a -1 to 1 depth range, which is also conservative for 0 to 1
+		return {
+			.planes = {
+				row_w + row_x, // Left
+				row_w - row_x, // Right
+				row_w + row_y, // Bottom
+				row_w - row_y, // Top
+				row_w + row_z, // Near
+				row_w - row_z, // Far
+			}
+		};
+	}
+
+	void FrustumCuller::cull(
+		std::span<IRenderer* const> renderers,
+		std::span<const AABB>		world_bounds,
+		const FrameUniformData&		frame_data
+	)
+	{
+		visible.assign(renderers.size(), 1);
+		culled_count = 0;
+
+		for (auto& packed : bounds) { packed.clear(); }
+
+		for (size_t idx = 0; idx < renderers.size(); idx++)
+		{
+			const IRenderer* renderer = renderers[idx];
+			if (renderer == nullptr || renderer->needsResourceUpdate()) { continue; }
+
+			// Empty meshes are skipped when recording anyway
+			if (renderer->getMeshContext().vbo_vert_count == 0) { continue; }
+
+			const AABB& box = world_bounds[idx];
+
+			bounds[static_cast<size_t>(renderer->getProjectionType())]
+				.add(static_cast<uint32_t>(idx), box.getCenter(), box.getExtent());
+		}
+
+		const std::array<Frustum, 2> frusta = {
+			Frustum::fromMatrix(frame_data.mat_vp),
+			Frustum::fromMatrix(frame_data.mat_vp_ortho)
+		};
+
+		for (size_t projection = 0; projection < bounds.size(); projection++)
+		{
+			const auto& packed = bounds[projection];
+
+			testBounds(frusta[projection], packed, test_results);
+
+			for (size_t idx = 0; idx < packed.indices.size(); idx++)
+			{
+				if (test_results[idx] != 0) { continue; }
+
+				visible[packed.indices[idx]] = 0;
+				culled_count++;
+			}
+		}
+	}
+
+#pragma endregion
+
+#pragma region Private
+
+	void FrustumCuller::PackedBounds::clear()
+	{
+		indices.clear();
+		center_x.clear();
+		center_y.clear();
+		center_z.clear();
+		extent_x.clear();
+		extent_y.clear();
+		extent_z.clear();
+	}
+
+	void FrustumCuller::PackedBounds::add(
+		uint32_t		 index,
+		const glm::vec3& center,
+		const glm::vec3& extent
+	)
+	{
+		indices.push_back(index);
+		center_x.push_back(center.x);
+		center_y.push_back(center.y);
+		center_z.push_back(center.z);
+		extent_x.push_back(extent.x);
+		extent_y.push_back(extent.y);
+		extent_z.push_back(extent.z);
+	}
+
+#pragma endregion
+} // namespace Engine::Rendering
@@ -5,6 +5,8 @@
 
 #include "Scripting/ILuaScript.hpp"
 
+#include "Profiling.hpp"
+
 #include <algorithm>
 #include <array>
 #include <iterator>
@@ -30,32 +32,30 @@ namespace Engine::Rendering
 		}
 	}
 
-	void GeneratorMeshBuilder::build()
+	bool GeneratorMeshBuilder::generateMesh()
 	{
-		if (context.vbo == nullptr)
-		{
-			std::vector<RenderingVertex> generated_mesh;
+		PROFILE_ZONE_CATEGORY("GeneratorMeshBuilder::generateMesh", "mesh");
 
-			Scripting::ScriptFunctionRef supplier = script_data.supplier;
+		if (context.vbo != nullptr) { return false; }
 
-			std::array<void*, 3> generator_data = {&generated_mesh, &supplier, &(world_pos)};
+		std::vector<RenderingVertex> generated_mesh;
 
-			script_data.generator(&generator_data);
+		Scripting::ScriptFunctionRef supplier = script_data.supplier;
 
-			if (!generated_mesh.empty())
-			{
-				// Create context
-				std::copy(generated_mesh.begin(), generated_mesh.end(), std::back_inserter(mesh));
+		std::array<void*, 3> generator_data = {&generated_mesh, &supplier, &(world_pos)};
 
-				context = MeshBuildContext();
-				context.rebuildVBO(instance, mesh);
-			}
-			else
-			{
-				// Renderers shall skip the render if there are no vertices
-				context.vbo_vert_count = 0;
-			}
-			needs_rebuild = false;
+		script_data.generator(&generator_data);
+
+		if (generated_mesh.empty())
+		{
+			// Renderers shall skip the render if there are no vertices
+			context.vbo_vert_count = 0;
+			return false;
 		}
+
+		// Create context
+		std::copy(generated_mesh.begin(), generated_mesh.end(), std::back_inserter(mesh));
+
+		return true;
 	}
 } // namespace Engine::Rendering
@@ -11,6 +11,7 @@
 
 #include "Engine.hpp"
 #include "Exception.hpp"
+#include "Profiling.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -50,15 +51,12 @@ namespace Engine::Rendering
 		}
 	}
 
-	void TextMeshBuilder::build()
+	bool TextMeshBuilder::generateMesh()
 	{
-		if (context.vbo != nullptr)
-		{
-			delete context.vbo;
+		PROFILE_ZONE_CATEGORY("TextMeshBuilder::generateMesh", "mesh");
 
-			context.vbo = nullptr;
-			mesh.clear();
-		}
+		// Old vertex buffer gets replaced on upload
+		mesh.clear();
 
 		const auto* window_data = owner_engine->getVulkanInstance()->getWindow();
 		screen_size				= window_data->getFramebufferSize();
@@ -228,8 +226,6 @@ namespace Engine::Rendering
 		// Create context
 		std::copy(generated_mesh.begin(), generated_mesh.end(), std::back_inserter(mesh));
 
-		context = MeshBuildContext();
-		context.rebuildVBO(instance, mesh);
-		needs_rebuild = false;
+		return true;
 	}
 } // namespace Engine::Rendering
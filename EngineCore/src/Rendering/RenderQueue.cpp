@@ -0,0 +1,152 @@
+#include "Rendering/RenderQueue.hpp"
+
+#include "Rendering/Vulkan/common.hpp"
+#include "Rendering/Vulkan/exports.hpp"
+
+#include "Profiling.hpp"
+#include "glm/mat4x4.hpp"
+#include "glm/vec4.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Engine::Rendering
+{
+#pragma region Internal static
+
+	namespace
+	{
+		enum class Pass : uint64_t
+		{
+			world  = 0,
+			screen = 1
+		};
+
+		/**
+		 * Map a float to an unsigned integer that sorts in the same order
+		 */
+		[[nodiscard]] uint32_t orderedBits(float value) noexcept
+		{
+			const auto bits = std::bit_cast<uint32_t>(value);
+
+			return (bits & 0x80000000U) != 0 ? ~bits : (bits | 0x80000000U);
+		}
+
+		/**
+		 * Place the lowest @p bit_count bits of @p value at @p shift
+		 */
+		[[nodiscard]] uint64_t keyField(uint64_t value, uint32_t bit_count, uint32_t shift) noexcept
+		{
+			return (value & ((uint64_t{1} << bit_count) - 1)) << shift;
+		}
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+	uint64_t RenderQueue::makeSortKey(const RenderItem& item, const FrameUniformData& frame_data)
+	{
+		const uint32_t pipeline_id = item.pipeline->getOrigin()->getId();
+
+		if (item.matrix_data.projection == ProjectionType::perspective)
+		{
+			// Distance along the view direction, nearest first so that occluded fragments
+			// are rejected by the depth test
+			const float	   depth = (frame_data.mat_vp * glm::vec4(item.world_center, 1.0f)).w;
+			const uint32_t depth_bits = orderedBits(depth) >> 2;
+
+			return keyField(static_cast<uint64_t>(Pass::world), 2, 62) |
+				   keyField(pipeline_id, 16, 46) | keyField(item.texture_key, 16, 30) |
+				   keyField(depth_bits, 30, 0);
+		}
+
+		// Farthest first, so that blended edges are drawn over what lies behind them
+		const float depth = (frame_data.mat_vp_ortho * glm::vec4(item.world_center, 1.0f)).z;
+		const uint32_t depth_bits = ~orderedBits(depth) >> 8;
+
+		return keyField(static_cast<uint64_t>(Pass::screen), 2, 62) | keyField(item.layer, 8, 54) |
+			   keyField(depth_bits, 24, 30) | keyField(pipeline_id, 16, 14) |
+			   keyField(item.texture_key, 14, 0);
+	}
+
+	void RenderQueue::sort(std::span<const RenderItem> items, const FrameUniformData& frame_data)
+	{
+		PROFILE_ZONE_CATEGORY("RenderQueue::sort", "render");
+
+		entries.clear();
+		entries.reserve(items.size());
+
+		for (size_t idx = 0; idx < items.size(); idx++)
+		{
+			const RenderItem& item = items[idx];
+
+			// Render only if VBO non-empty
+			if (item.pipeline == nullptr || item.vertex_count == 0) { continue; }
+
+			entries.push_back(
+				{.key = makeSortKey(item, frame_data), .index = static_cast<uint32_t>(idx)}
+			);
+		}
+
+		// Equal keys keep the order of the items, so that every frame draws the same
+		std::ranges::sort(entries, [](const Entry& lhs, const Entry& rhs) {
+			return lhs.key != rhs.key ? lhs.key < rhs.key : lhs.index < rhs.index;
+		});
+
+		stats = {.draws = entries.size(), .pipeline_binds = 0};
+
+		const Vulkan::Pipeline* last_pipeline = nullptr;
+		for (const auto& entry : entries)
+		{
+			const auto* pipeline = items[entry.index].pipeline->getOrigin();
+			if (pipeline == last_pipeline) { continue; }
+
+			last_pipeline = pipeline;
+			stats.pipeline_binds++;
+		}
+	}
+
+	void RenderQueue::record(
+		std::span<const RenderItem> items,
+		Vulkan::CommandBuffer*		command_buffer,
+		uint32_t					current_frame
+	) const
+	{
+		PROFILE_ZONE_CATEGORY("RenderQueue::record", "render");
+
+		const Vulkan::Pipeline* bound_pipeline = nullptr;
+		const Vulkan::Buffer*	bound_vbo	   = nullptr;
+
+		for (const auto& entry : entries)
+		{
+			const RenderItem& item = items[entry.index];
+
+			item.pipeline->getUniformBuffer(current_frame)
+				->memoryCopy(&item.matrix_data, sizeof(RendererMatrixData));
+
+			if (item.pipeline->getOrigin() != bound_pipeline)
+			{
+				item.pipeline->bindOrigin(*command_buffer);
+				bound_pipeline = item.pipeline->getOrigin();
+			}
+
+			// Set 1 also holds the matrices of the object, so it changes with every draw
+			item.pipeline->bindDescriptorSets(*command_buffer, current_frame);
+
+			// Instances of a template share their vertex buffer
+			if (item.vbo != bound_vbo)
+			{
+				command_buffer->bindVertexBuffers(0, {*item.vbo->getHandle()}, {0});
+				bound_vbo = item.vbo;
+			}
+
+			command_buffer->draw(item.vertex_count, 1, 0, 0);
+		}
+	}
+
+#pragma endregion
+} // namespace Engine::Rendering
@@ -0,0 +1,125 @@
+#include "Rendering/RenderThread.hpp"
+
+#include "Rendering/RenderSnapshot.hpp"
+#include "Rendering/Vulkan/exports.hpp"
+#include "Rendering/Vulkan/rendering.hpp"
+
+#include "Logging/Logging.hpp"
+
+#include "Profiling.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace Engine::Rendering
+{
+#pragma region Public
+
+	RenderThread::RenderThread(
+		const Logging::SupportsLogging::logger_t& with_logger,
+		Vulkan::Window*							 with_window,
+		Vulkan::PipelineManager*				 with_pipeline_manager
+	)
+		: Logging::SupportsLogging(with_logger), window(with_window),
+		  pipeline_manager(with_pipeline_manager)
+	{
+		window->setRenderCallback(RenderThread::recordCallback, this);
+
+		thread = std::thread(&RenderThread::threadMain, this);
+	}
+
+	RenderThread::~RenderThread()
+	{
+		{
+			std::lock_guard guard(lock);
+			should_exit = true;
+		}
+		state_changed.notify_all();
+
+		thread.join();
+
+		this->logger->logSingle<decltype(this)>(Logging::LogLevel::Debug, "Destructor called");
+	}
+
+	void RenderThread::submit()
+	{
+		waitIdle();
+
+		{
+			std::lock_guard guard(lock);
+
+			front_snapshot = 1 - front_snapshot;
+			frame_pending  = true;
+		}
+		state_changed.notify_all();
+	}
+
+	void RenderThread::waitIdle()
+	{
+		PROFILE_ZONE("RenderThread::waitIdle");
+
+		std::unique_lock guard(lock);
+		state_changed.wait(guard, [&] { return !frame_pending; });
+
+		if (render_exception) { std::rethrow_exception(std::exchange(render_exception, nullptr)); }
+	}
+
+#pragma endregion
+
+#pragma region Private
+
+	void RenderThread::threadMain()
+	{
+		this->logger->mapCurrentThreadToName("render");
+		Base::Profiling::setThreadName("render");
+
+		while (true)
+		{
+			{
+				std::unique_lock guard(lock);
+				state_changed.wait(guard, [&] { return frame_pending || should_exit; });
+
+				if (should_exit) { return; }
+			}
+
+			try
+			{
+				PROFILE_ZONE("Window::drawFrame");
+
+				window->drawFrame();
+			}
+			catch (...)
+			{
+				std::lock_guard guard(lock);
+				render_exception = std::current_exception();
+			}
+
+			{
+				std::lock_guard guard(lock);
+				frame_pending = false;
+			}
+			state_changed.notify_all();
+		}
+	}
+
+	void RenderThread::recordCallback(
+		Vulkan::CommandBuffer* command_buffer,
+		uint32_t			   current_frame,
+		void*				   render_thread
+	)
+	{
+		auto* self = static_cast<RenderThread*>(render_thread);
+
+		// Front snapshot is only swapped while no frame is pending
+		const auto& snapshot = self->snapshots[self->front_snapshot];
+
+		self->pipeline_manager->bindFrameData(*command_buffer, current_frame, snapshot.frame_data);
+
+		snapshot.queue.record(snapshot.items, command_buffer, current_frame);
+	}
+
+#pragma endregion
+} // namespace Engine::Rendering
@@ -5,19 +5,19 @@
 #include "Assets/Texture.hpp"
 #include "Rendering/MeshBuilders/IMeshBuilder.hpp"
 #include "Rendering/SupplyData.hpp"
-#include "Rendering/Transform.hpp"
 #include "Rendering/Vulkan/backend.hpp"
 #include "Rendering/Vulkan/common.hpp"
 #include "Rendering/Vulkan/rendering.hpp"
 
 #include "Engine.hpp"
 #include "InternalEngineObject.hpp"
-#include "objects/CommandBuffer.hpp"
+#include "Profiling.hpp"
+#include "glm/vec3.hpp"
+#include "glm/vec4.hpp"
 #include "vulkan/vulkan.hpp"
 
-#include "glm/gtc/quaternion.hpp"
-
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -103,9 +103,17 @@ namespace Engine::Rendering
 
 		if (texture)
 		{
-			settings.descriptor_settings[1].opt_match_hash = std::hash<Asset>{}(*texture);
+			const size_t texture_hash = std::hash<Asset>{}(*texture);
+
+			settings.descriptor_settings[1].opt_match_hash = texture_hash;
+			texture_key = static_cast<uint32_t>(texture_hash);
 		}
 
+		// Screen-space draws are ordered by layer and back-to-front instead of by depth
+		settings.depth_write = getProjectionType() == ProjectionType::perspective;
+
+		// Frames in flight may still draw with the previous reference, it retires itself
+		delete pipeline;
 		pipeline = pipeline_manager->getPipeline(settings);
 
 		if (texture)
@@ -132,8 +140,10 @@ namespace Engine::Rendering
 		}
 	}
 
-	void IRenderer::render(Vulkan::CommandBuffer* command_buffer, uint32_t current_frame)
+	RenderItem IRenderer::prepareRender()
 	{
+		PROFILE_ZONE_CATEGORY("IRenderer::prepareRender", "render");
+
 		if (!has_updated_matrices)
 		{
 			updateMatrices();
@@ -151,88 +161,31 @@ namespace Engine::Rendering
 		}
 		mesh_context = mesh_builder->getContext();
 
-		// Render only if VBO non-empty
-		if (mesh_context.vbo_vert_count > 0)
-		{
-			pipeline->getUniformBuffer(current_frame)
-				->memoryCopy(&matrix_data, sizeof(RendererMatrixData));
-
-			pipeline->bindPipeline(*command_buffer, current_frame);
+		const glm::vec4 local_center = glm::vec4(mesh_context.bounds.getCenter(), 1.0f);
 
-			command_buffer->bindVertexBuffers(0, {*mesh_context.vbo->getHandle()}, {0});
-
-			command_buffer->draw(static_cast<uint32_t>(mesh_context.vbo_vert_count), 1, 0, 0);
-		}
+		return {
+			.pipeline	  = pipeline,
+			.vbo		  = mesh_context.vbo.get(),
+			.vertex_count = static_cast<uint32_t>(mesh_context.vbo_vert_count),
+			.world_center = glm::vec3(world_matrix * local_center),
+			.texture_key  = texture_key,
+			.layer		  = layer,
+			.matrix_data  = matrix_data
+		};
 	}
 
-	namespace
-	{
-		/**
-		 * Apply a single transform onto a matrix.
-		 *
-		 * @param[in] transform Transform to apply.
-		 * @param[in] apply_to Matrix to apply to or an identity matrix if omitted.
-		 * @return The resulting matrix.
-		 */
-		[[nodiscard]] glm::mat4 applyTransformToMatrix(
-			const Transform& transform,
-			const glm::mat4& apply_to = glm::identity<glm::mat4>()
-		)
-		{
-			const glm::quat quat_rotation = glm::quat(glm::radians(transform.rotation));
-
-			// model = position * rotation * scale
-			auto translated = glm::translate(apply_to, transform.pos);
-			auto rotated	= translated * glm::mat4_cast(quat_rotation);
-			auto scaled		= glm::scale(rotated, transform.size);
-
-			return scaled;
-		}
-
-		/**
-		 * Calculate model matrix of an object.
-		 *
-		 * @param[in] local Transform of the current object.
-		 * @param[in] parent Transform of the parent object.
-		 * @return The resulting matrix.
-		 */
-		[[nodiscard]] glm::mat4 calculateModelMatrix(const Transform& local, const Transform& parent)
-		{
-			glm::mat4 model_parent = applyTransformToMatrix(parent);
-			glm::mat4 model		   = applyTransformToMatrix(local, model_parent);
-
-			return model;
-		}
-	} // namespace
-
 	void Renderer2D::updateMatrices()
 	{
-		glm::mat4 projection{};
-
-		auto scene_manager = owner_engine->getSceneManager().lock();
-		assert(scene_manager);
-
-		projection = scene_manager->getProjectionMatrixOrtho();
-
-		matrix_data.mat_model = calculateModelMatrix(transform, parent_transform);
-		matrix_data.mat_vp	  = projection;
+		matrix_data.mat_model  = world_matrix;
+		matrix_data.projection = getProjectionType();
 
 		has_updated_matrices = true;
 	}
 
 	void Renderer3D::updateMatrices()
 	{
-		glm::mat4 view;
-		glm::mat4 projection;
-
-		auto scene_manager = owner_engine->getSceneManager().lock();
-		assert(scene_manager);
-
-		view	   = scene_manager->getCameraViewMatrix();
-		projection = scene_manager->getProjectionMatrix();
-
-		matrix_data.mat_model = calculateModelMatrix(transform, parent_transform);
-		matrix_data.mat_vp	  = projection * view;
+		matrix_data.mat_model  = world_matrix;
+		matrix_data.projection = getProjectionType();
 
 		has_updated_matrices = true;
 	}
@@ -1,7 +1,14 @@
 #include "Scene.hpp"
 
 #include "Assets/AssetManager.hpp"
+#include "Assets/Font.hpp"
+#include "Assets/Texture.hpp"
+#include "Rendering/MeshBuilders/IMeshBuilder.hpp"
+#include "Rendering/Transform.hpp"
 #include "Rendering/Vulkan/backend.hpp"
+#include "Rendering/Vulkan/common.hpp"
+
+#include "Scripting/ILuaScript.hpp"
 
 #include "Factories/ObjectFactory.hpp"
 
@@ -10,12 +17,20 @@
 #include "Engine.hpp"
 #include "Exception.hpp"
 #include "InternalEngineObject.hpp"
+#include "MemoryUsage.hpp"
 #include "SceneObject.hpp"
+#include "SpatialIndex.hpp"
+#include "glm/vec3.hpp"
+#include "lua.hpp"
 
+#include <cstddef>
 #include <format>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace Engine
 {
@@ -27,38 +42,43 @@ namespace Engine
 	{
 		this->logger->logSingle<decltype(this)>(Logging::LogLevel::VerboseDebug, "Destructor called");
 
+		for (auto& [name, state] : templates)
+		{
+			for (auto* instance : state.free_instances) { delete instance; }
+		}
+		template_instances.clear();
 		templates.clear();
 
-		for (auto& [name, ptr] : objects)
+		const auto names = objects.getNames();
+		const auto ptrs	 = objects.getObjects();
+		for (size_t idx = 0; idx < ptrs.size(); idx++)
 		{
 			this->logger->logSingle<decltype(this)>(
 				Logging::LogLevel::VerboseDebug,
 				"Deleting object '{}'",
-				name
+				names[idx]
 			);
-			delete ptr;
+			delete ptrs[idx];
 		}
-
-		objects.clear();
-	}
-
-	const std::unordered_map<std::string, SceneObject*>& Scene::getAllObjects() noexcept
-	{
-		return objects;
 	}
 
-	void Scene::addTemplatedObject(const std::string& name, const std::string& template_name)
+	ObjectHandle Scene::addTemplatedObject(const std::string& name, const std::string& template_name)
 	{
 		auto templated_object = templates.find(template_name);
 
 		if (templated_object != templates.end())
 		{
-			SceneObject* obj = Factories::ObjectFactory::instantiateObjectTemplate(
-				getOwnerEngine(),
-				templated_object->second
-			);
+			SceneObject* obj = acquireInstance(templated_object->second);
 
-			addObject(name, obj);
+			try
+			{
+				return addObject(name, obj);
+			}
+			catch (...)
+			{
+				if (!recycleInstance(obj)) { delete obj; }
+				throw;
+			}
 		}
 		else
 		{
@@ -68,7 +88,7 @@ namespace Engine
 		}
 	}
 
-	void Scene::addObject(const std::string& name, SceneObject* ptr)
+	ObjectHandle Scene::addObject(const std::string& name, SceneObject* ptr)
 	{
 		if (ptr == nullptr)
 		{
@@ -77,29 +97,81 @@ namespace Engine
 
 		this->logger->logSingle<decltype(this)>(Logging::LogLevel::Debug, "Adding object '{}'", name);
 
-			objects.emplace(name, ptr);
+		return objects.insert(name, ptr);
 	}
 
 	SceneObject* Scene::findObject(const std::string& name)
 	{
-		auto find_ret = objects.find(name);
-		if (find_ret != objects.end()) { return find_ret->second; }
-		return nullptr;
+		return objects.get(objects.find(name));
 	}
 
-	void Scene::removeObject(const std::string& name)
+	ObjectHandle Scene::findHandle(const std::string& name) const noexcept
 	{
-		SceneObject* object = findObject(name);
+		return objects.find(name);
+	}
 
-		if (object != nullptr)
-		{
-			objects.erase(name);
-			delete object;
-		}
-		else
+	SceneObject* Scene::getObject(ObjectHandle handle) const noexcept
+	{
+		return objects.get(handle);
+	}
+
+	void Scene::removeObject(const std::string& name)
+	{
+		SceneObject* object = objects.erase(objects.find(name));
+		if (object == nullptr)
 		{
 			throw ENGINE_EXCEPTION(std::format("Could not remove non-existent object '{}'!", name));
 		}
+
+		// Unlinked right away, but frames in flight may still be drawing the object
+		object->removeChildren();
+		object->setParent(nullptr);
+
+		if (recycleInstance(object)) { return; }
+
+		owner_engine->getVulkanInstance()->getDeletionQueue()->retire(object);
+	}
+
+	size_t Scene::updateTransforms()
+	{
+		const size_t updated_count = objects.updateTransforms();
+		objects.updateMeshBounds();
+
+		return updated_count;
+	}
+
+	std::vector<ObjectHandle>
+	Scene::queryRadius(SpatialIndex::Space space, const glm::vec3& center, float radius)
+	{
+		updateTransforms();
+
+		std::vector<ObjectHandle> result;
+		objects.getSpatialIndex().queryRadius(space, center, radius, result);
+		return result;
+	}
+
+	std::vector<ObjectHandle>
+	Scene::queryAABB(SpatialIndex::Space space, const glm::vec3& min, const glm::vec3& max)
+	{
+		updateTransforms();
+
+		std::vector<ObjectHandle> result;
+		objects.getSpatialIndex().queryAABB(space, {.min = min, .max = max}, result);
+		return result;
+	}
+
+	std::vector<ObjectHandle> Scene::queryRay(
+		SpatialIndex::Space space,
+		const glm::vec3&	origin,
+		const glm::vec3&	direction,
+		float				max_distance
+	)
+	{
+		updateTransforms();
+
+		std::vector<ObjectHandle> result;
+		objects.getSpatialIndex().queryRay(space, origin, direction, max_distance, result);
+		return result;
 	}
 
 	void Scene::loadTemplatedObject(
@@ -107,6 +179,165 @@ namespace Engine
 		const Factories::ObjectFactory::ObjectTemplate& object
 	)
 	{
-		templates.emplace(name, object);
+		TemplateState state{.object_template = object, .mesh_prototype = {}, .free_instances = {}};
+
+		// Instances draw one mesh built from the template instead of each building their own
+		if (Factories::ObjectFactory::isMeshShareable(object.with_mesh_builder))
+		{
+			state.mesh_prototype.reset(Factories::ObjectFactory::createMeshBuilder(
+				getOwnerEngine(),
+				object.with_mesh_builder,
+				object.meshbuilder_supply_list
+			));
+		}
+
+		templates.emplace(name, std::move(state));
+	}
+
+	MemoryUsage Scene::getMemoryUsage()
+	{
+		MemoryUsage usage;
+
+		asset_repository->forEachAsset<Rendering::Texture>(
+			[&](const std::string&, const auto& texture) { usage += texture->getMemoryUsage(); }
+		);
+		asset_repository->forEachAsset<Rendering::Font>(
+			[&](const std::string&, const auto& font) { usage += font->getMemoryUsage(); }
+		);
+		asset_repository->forEachAsset<Scripting::ILuaScript>(
+			[&](const std::string&, const auto& script) {
+				// Size of the script's Lua heap
+				lua_State* state = script->getState();
+
+				usage.cpu_bytes += static_cast<size_t>(lua_gc(state, LUA_GCCOUNT, 0)) * 1024 +
+								   static_cast<size_t>(lua_gc(state, LUA_GCCOUNTB, 0));
+			}
+		);
+
+		// Vertex buffers shared by template instances are counted once
+		std::unordered_set<const Rendering::Vulkan::Buffer*> counted_buffers;
+
+		auto add_mesh = [&](const Rendering::IMeshBuilder* builder) {
+			usage.cpu_bytes += builder->getMeshMemory();
+
+			const auto& context = builder->getContext();
+			if (context.vbo != nullptr && counted_buffers.insert(context.vbo.get()).second)
+			{
+				usage.gpu_bytes += context.vbo_vert_count * sizeof(Rendering::RenderingVertex);
+			}
+		};
+
+		auto add_object = [&](SceneObject* object) {
+			usage.cpu_bytes += sizeof(SceneObject);
+			add_mesh(object->getMeshBuilder());
+
+			// Uniform buffers of the renderer, one per frame in flight
+			usage.gpu_bytes += Rendering::max_frames_in_flight *
+							   sizeof(Rendering::RendererMatrixData);
+		};
+
+		for (auto* object : objects.getObjects()) { add_object(object); }
+
+		for (const auto& [name, state] : templates)
+		{
+			if (state.mesh_prototype != nullptr) { add_mesh(state.mesh_prototype.get()); }
+			for (auto* instance : state.free_instances) { add_object(instance); }
+		}
+
+		return usage;
+	}
+
+	std::vector<Rendering::IMeshBuilder*> Scene::getPendingTemplateMeshes() const
+	{
+		std::vector<Rendering::IMeshBuilder*> builders;
+		for (const auto& [name, state] : templates)
+		{
+			if (state.mesh_prototype != nullptr && state.mesh_prototype->needsRebuild())
+			{
+				builders.push_back(state.mesh_prototype.get());
+			}
+		}
+
+		return builders;
+	}
+
+	SceneObject* Scene::acquireInstance(TemplateState& from_template)
+	{
+		if (!from_template.free_instances.empty())
+		{
+			SceneObject* object = from_template.free_instances.back();
+			from_template.free_instances.pop_back();
+
+			return object;
+		}
+
+		SceneObject* object = Factories::ObjectFactory::instantiateObjectTemplate(
+			getOwnerEngine(),
+			from_template.object_template
+		);
+
+		const auto& prototype = from_template.mesh_prototype;
+		if (prototype != nullptr)
+		{
+			// Until the template's mesh is uploaded instances build their own
+			if (!prototype->needsRebuild())
+			{
+				object->getMeshBuilder()->adoptMesh(prototype->getContext());
+			}
+
+			template_instances.emplace(object, &from_template);
+		}
+
+		return object;
+	}
+
+	bool Scene::recycleInstance(SceneObject* object)
+	{
+		const auto instance = template_instances.find(object);
+		if (instance == template_instances.end()) { return false; }
+
+		auto& free_instances = instance->second->free_instances;
+		if (free_instances.size() >= max_free_instances)
+		{
+			template_instances.erase(instance);
+			return false;
+		}
+
+		// Per-frame uniform buffers are rewritten before every draw, so the instance
+		// may be added again right away even if frames in flight still draw it
+		resetInstance(object, *instance->second);
+
+		free_instances.push_back(object);
+		return true;
+	}
+
+	void Scene::resetInstance(SceneObject* object, const TemplateState& from_template)
+	{
+		// Same state as an instance that was just created from the template
+		const Rendering::Transform initial_transform{};
+
+		object->setPosition(initial_transform.pos);
+		object->setSize(initial_transform.size);
+		object->setRotation(initial_transform.rotation);
+		object->setLayer(0);
+
+		const auto& object_template = from_template.object_template;
+
+		auto* renderer = object->getRenderer();
+		renderer->clearSupplyData();
+		for (const auto& supply : object_template.renderer_supply_list)
+		{
+			renderer->supplyData(supply);
+		}
+
+		auto* builder = object->getMeshBuilder();
+		for (const auto& supply : object_template.meshbuilder_supply_list)
+		{
+			builder->supplyData(supply);
+		}
+
+		// Back to the template's mesh, unless it isn't uploaded yet
+		const auto& prototype = from_template.mesh_prototype;
+		if (!prototype->needsRebuild()) { builder->adoptMesh(prototype->getContext()); }
 	}
 } // namespace Engine
@@ -0,0 +1,40 @@
+#include "SceneBudget.hpp"
+
+#include "MemoryUsage.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace Engine
+{
+	bool isOverBudget(const MemoryUsage& usage, const MemoryUsage& budget)
+	{
+		return (budget.cpu_bytes != 0 && usage.cpu_bytes > budget.cpu_bytes) ||
+			   (budget.gpu_bytes != 0 && usage.gpu_bytes > budget.gpu_bytes);
+	}
+
+	std::vector<SceneBudgetEntry>
+	selectScenesToUnload(std::vector<SceneBudgetEntry> scenes, const MemoryUsage& budget)
+	{
+		MemoryUsage total;
+		for (const auto& scene : scenes) { total += scene.usage; }
+
+		std::vector<SceneBudgetEntry> unload;
+		if (!isOverBudget(total, budget)) { return unload; }
+
+		// Least recently used first
+		std::ranges::sort(scenes, {}, &SceneBudgetEntry::last_used);
+
+		for (auto& scene : scenes)
+		{
+			if (!isOverBudget(total, budget)) { break; }
+			if (!scene.is_unloadable) { continue; }
+
+			total -= scene.usage;
+			unload.push_back(std::move(scene));
+		}
+
+		return unload;
+	}
+} // namespace Engine
@@ -0,0 +1,252 @@
+#include "SceneCompiler.hpp"
+
+#include "Assets/AssetManager.hpp"
+#include "Rendering/SupplyData.hpp"
+
+#include "Factories/ObjectFactory.hpp"
+
+#include "EnumStringConvertor.hpp"
+#include "EventHandling.hpp"
+#include "Exception.hpp"
+#include "SceneFormat.hpp"
+#include "nlohmann/json.hpp"
+#include "vulkan/vulkan_enums.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine::SceneCompiler
+{
+	namespace
+	{
+		/**
+		 * Strings of a compiled scene, equal strings are stored once
+		 */
+		class StringTable
+		{
+		public:
+			SceneFormat::StringRef add(const std::string& value)
+			{
+				const SceneFormat::StringRef ref = {
+					.offset = static_cast<uint32_t>(data.size()),
+					.length = static_cast<uint32_t>(value.size())
+				};
+
+				auto [entry, inserted] = refs.try_emplace(value, ref);
+				if (inserted) { data.append(value); }
+
+				return entry->second;
+			}
+
+			[[nodiscard]] const std::string& getData() const noexcept
+			{
+				return data;
+			}
+
+		private:
+			std::string												data;
+			std::unordered_map<std::string, SceneFormat::StringRef> refs;
+		};
+
+		template <typename enum_t> [[nodiscard]] uint32_t resolveEnum(const nlohmann::json& value)
+		{
+			const enum_t resolved = EnumStringConvertor<enum_t>(value.get<std::string>());
+
+			return static_cast<uint32_t>(resolved);
+		}
+
+		void alignOutput(std::vector<std::byte>& output)
+		{
+			const size_t remainder = output.size() % SceneFormat::record_alignment;
+			if (remainder != 0)
+			{
+				output.resize(output.size() + SceneFormat::record_alignment - remainder);
+			}
+		}
+
+		template <SceneFormat::Record record_t>
+		SceneFormat::Section appendRecords(
+			std::vector<std::byte>&		 output,
+			const std::vector<record_t>& records
+		)
+		{
+			alignOutput(output);
+
+			const SceneFormat::Section section = {
+				.offset = static_cast<uint32_t>(output.size()),
+				.count	= static_cast<uint32_t>(records.size())
+			};
+
+			const auto* bytes = reinterpret_cast<const std::byte*>(records.data());
+			output.insert(output.end(), bytes, bytes + records.size() * sizeof(record_t));
+
+			return section;
+		}
+
+		SceneFormat::AssetRecord compileAsset(StringTable& strings, const nlohmann::json& entry)
+		{
+			SceneFormat::AssetRecord record = {
+				.name		   = strings.add(entry.at("name").get<std::string>()),
+				.location	   = strings.add(entry.at("location").get<std::string>()),
+				.type		   = static_cast<uint8_t>(resolveEnum<AssetType>(entry.at("type"))),
+				.is_generator  = static_cast<uint8_t>(entry.contains("is_generator")),
+				.padding	   = {},
+				.filtering	   = static_cast<uint32_t>(vk::Filter::eLinear),
+				.sampling_mode = static_cast<uint32_t>(vk::SamplerAddressMode::eRepeat)
+			};
+
+			if (entry.contains("filtering"))
+			{
+				record.filtering = resolveEnum<vk::Filter>(entry["filtering"]);
+			}
+
+			if (entry.contains("sampling_mode"))
+			{
+				record.sampling_mode = resolveEnum<vk::SamplerAddressMode>(entry["sampling_mode"]);
+			}
+
+			return record;
+		}
+
+		template <typename supply_data_t>
+		SceneFormat::Section compileSupplyData(
+			StringTable&							strings,
+			std::vector<SceneFormat::SupplyRecord>& supply_data,
+			const nlohmann::json&					entries
+		)
+		{
+			const SceneFormat::Section section = {
+				.offset = static_cast<uint32_t>(supply_data.size()),
+				.count	= static_cast<uint32_t>(entries.size())
+			};
+
+			for (const auto& supply_entry : entries)
+			{
+				supply_data.push_back({
+					.type  = resolveEnum<typename supply_data_t::Type>(supply_entry.at(0)),
+					.value = strings.add(supply_entry.at(1).get<std::string>()),
+				});
+			}
+
+			return section;
+		}
+	} // namespace
+
+	std::vector<std::byte> compile(const nlohmann::json& data)
+	{
+		StringTable strings;
+
+		std::vector<SceneFormat::AssetRecord>		 assets;
+		std::vector<SceneFormat::EventHandlerRecord> event_handlers;
+		std::vector<SceneFormat::TemplateRecord>	 templates;
+		std::vector<SceneFormat::SupplyRecord>		 supply_data;
+
+		for (const auto& entry : data.at("assets"))
+		{
+			try
+			{
+				assets.push_back(compileAsset(strings, entry));
+			}
+			catch (...)
+			{
+				std::throw_with_nested(ENGINE_EXCEPTION(
+					std::format("Failed compiling asset! Relevant JSON:\n'{}'", entry.dump(4))
+				));
+			}
+		}
+
+		for (const auto& entry : data.at("event_handlers"))
+		{
+			event_handlers.push_back({
+				.event_type = resolveEnum<EventHandling::EventType>(entry.at("type")),
+				.script		= strings.add(entry.at("file").get<std::string>()),
+				.function	= strings.add(entry.at("function").get<std::string>()),
+			});
+		}
+
+		for (const auto& entry : data.at("templates"))
+		{
+			using namespace Factories::ObjectFactory;
+
+			SceneFormat::TemplateRecord record = {
+				.name	= strings.add(entry.at("name").get<std::string>()),
+				.shader = strings.add(entry.at("shader_name").get<std::string>()),
+				.renderer = static_cast<uint8_t>(resolveEnum<RendererType>(entry.at("renderer"))),
+				.mesh_builder =
+					static_cast<uint8_t>(resolveEnum<MeshBuilderType>(entry.at("mesh_builder"))),
+				.padding			= {},
+				.renderer_supply	= {},
+				.meshbuilder_supply = {}
+			};
+
+			record.renderer_supply = compileSupplyData<Rendering::RendererSupplyData>(
+				strings,
+				supply_data,
+				entry.at("renderer_supply_data")
+			);
+			record.meshbuilder_supply = compileSupplyData<Rendering::MeshBuilderSupplyData>(
+				strings,
+				supply_data,
+				entry.at("meshbuilder_supply_data")
+			);
+
+			templates.push_back(record);
+		}
+
+		// The header is filled in once all offsets are known
+		std::vector<std::byte> output(sizeof(SceneFormat::Header));
+
+		SceneFormat::Header header = {
+			.magic				 = SceneFormat::magic,
+			.version			 = SceneFormat::version,
+			.string_table_offset = 0,
+			.string_table_size	 = static_cast<uint32_t>(strings.getData().size()),
+			.assets				 = appendRecords(output, assets),
+			.event_handlers		 = appendRecords(output, event_handlers),
+			.templates			 = appendRecords(output, templates),
+			.supply_data		 = appendRecords(output, supply_data)
+		};
+
+		header.string_table_offset = static_cast<uint32_t>(output.size());
+
+		const auto* string_bytes = reinterpret_cast<const std::byte*>(strings.getData().data());
+		output.insert(output.end(), string_bytes, string_bytes + strings.getData().size());
+
+		EXCEPTION_ASSERT(
+			output.size() <= std::numeric_limits<uint32_t>::max(),
+			"Compiled scene exceeds the 4 GiB addressable by its offsets!"
+		);
+
+		const auto* header_bytes = reinterpret_cast<const std::byte*>(&header);
+		std::copy(header_bytes, header_bytes + sizeof(header), output.begin());
+
+		return output;
+	}
+
+	std::vector<std::byte> compileDirectory(const std::filesystem::path& scene_path)
+	{
+		nlohmann::json data;
+
+		try
+		{
+			std::ifstream file(scene_path / SceneFormat::source_file_name);
+
+			data = nlohmann::json::parse(file);
+		}
+		catch (...)
+		{
+			std::throw_with_nested(ENGINE_EXCEPTION("Failed on json parse"));
+		}
+
+		return compile(data);
+	}
+} // namespace Engine::SceneCompiler
@@ -13,22 +13,28 @@
 
 #include "Logging/Logging.hpp"
 
+#include "CompiledScene.hpp"
 #include "Engine.hpp"
-#include "EnumStringConvertor.hpp"
 #include "EventHandling.hpp"
 #include "Exception.hpp"
+#include "Profiling.hpp"
 #include "Scene.hpp"
-#include "nlohmann/json.hpp"
+#include "SceneCompiler.hpp"
+#include "SceneFormat.hpp"
 #include "vulkan/vulkan_enums.hpp"
 
 #include <cassert>
+#include <chrono>
+#include <cstddef>
 #include <exception>
 #include <filesystem>
 #include <format>
-#include <fstream>
 #include <functional>
 #include <memory>
 #include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
 
 namespace Engine
 {
@@ -97,7 +103,62 @@ namespace Engine
 		 * @sa loadSceneAssetType()
 		 */
 		using asset_loader_fn_t = std::function<
-			void(Engine*, AssetRepository&, const std::string&, const std::filesystem::path&, const nlohmann::json&)>;
+			void(Engine*, AssetRepository&, const std::string&, const std::filesystem::path&, const SceneFormat::AssetRecord&, SceneLoader::PrefetchedAsset*)>;
+
+		std::shared_ptr<Scripting::ILuaScript> createScript(
+			Engine*							engine,
+			const std::filesystem::path&	asset_path,
+			const SceneFormat::AssetRecord& asset_record
+		)
+		{
+			if (asset_record.is_generator != 0)
+			{
+				return std::make_shared<Scripting::GeneratorLuaScript>(engine, asset_path);
+			}
+
+			return std::make_shared<Scripting::EventLuaScript>(engine, asset_path);
+		}
+
+		/**
+		 * Prepare the parts of an asset that don't need the engine thread or the GPU
+		 *
+		 * @note Fonts are not prefetched, their textures are only known after parsing the font
+		 */
+		SceneLoader::PrefetchedAsset prefetchSceneAssetEntry(
+			Engine*							engine,
+			const CompiledScene&			scene_data,
+			const SceneFormat::AssetRecord& asset_record,
+			const std::filesystem::path&	scene_path
+		)
+		{
+			const std::string asset_name(scene_data.getString(asset_record.name));
+			const std::filesystem::path asset_path = scene_path /
+													 scene_data.getString(asset_record.location);
+
+			PROFILE_ZONE_DYNAMIC(asset_name, "asset");
+
+			SceneLoader::PrefetchedAsset prefetched;
+
+			switch (static_cast<AssetType>(asset_record.type))
+			{
+				case AssetType::TEXTURE:
+				{
+					prefetched.image = Factories::TextureFactory(engine).decodeImage(asset_path);
+					break;
+				}
+				case AssetType::SCRIPT:
+				{
+					prefetched.script = createScript(engine, asset_path, asset_record);
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+
+			return prefetched;
+		}
 
 		/**
 		 * Load asset of a specific type
@@ -107,15 +168,17 @@ namespace Engine
 		 * @param asset_repository Repository to add the asset to
 		 * @param asset_name       Name of asset
 		 * @param asset_path       Path to asset
-		 * @param json_entry       JSON entry for the asset
+		 * @param asset_record     Compiled entry for the asset
+		 * @param prefetched       Results of @ref prefetchSceneAssetEntry() or nullptr
 		 */
 		template <AssetType type>
 		void loadSceneAssetType(
-			Engine*						 engine,
-			AssetRepository&			 asset_repository,
-			const std::string&			 asset_name,
-			const std::filesystem::path& asset_path,
-			const nlohmann::json&		 json_entry
+			Engine*							engine,
+			AssetRepository&				asset_repository,
+			const std::string&				asset_name,
+			const std::filesystem::path&	asset_path,
+			const SceneFormat::AssetRecord& asset_record,
+			SceneLoader::PrefetchedAsset*	prefetched
 		)
 		{
 			/**
@@ -127,26 +190,27 @@ namespace Engine
 
 			if constexpr (type == AssetType::TEXTURE)
 			{
-				vk::Filter filtering = vk::Filter::eLinear;
-				if (json_entry.contains("filtering"))
+				// Defaults were filled in by the compiler
+				const auto filtering	 = static_cast<vk::Filter>(asset_record.filtering);
+				const auto sampling_mode = static_cast<vk::SamplerAddressMode>(
+					asset_record.sampling_mode
+				);
+
+				if (prefetched != nullptr && prefetched->image.has_value())
 				{
-					filtering =
-						EnumStringConvertor<vk::Filter>(json_entry["filtering"].get<std::string>());
+					asset_repository.addAsset(
+						asset_name,
+						texture_factory
+							.createTexture(std::move(*prefetched->image), filtering, sampling_mode)
+					);
 				}
-
-				// Check if a specific sampling is requested, otherwise use default
-				vk::SamplerAddressMode sampling_mode = vk::SamplerAddressMode::eRepeat;
-				if (json_entry.contains("sampling_mode"))
+				else
 				{
-					sampling_mode = EnumStringConvertor<vk::SamplerAddressMode>(
-						json_entry["sampling_mode"].get<std::string>()
+					asset_repository.addAsset(
+						asset_name,
+						texture_factory.createTexture(asset_path, filtering, sampling_mode)
 					);
 				}
-
-				asset_repository.addAsset(
-					asset_name,
-					texture_factory.createTexture(asset_path, filtering, sampling_mode)
-				);
 			}
 			else if constexpr (type == AssetType::FONT)
 			{
@@ -161,35 +225,34 @@ namespace Engine
 			}
 			else if constexpr (type == AssetType::SCRIPT)
 			{
-				Scripting::ILuaScript* script;
-
-				if (json_entry.contains("is_generator"))
+				if (prefetched != nullptr && prefetched->script)
 				{
-					script = new Scripting::GeneratorLuaScript(engine, asset_path);
+					asset_repository.addAsset(asset_name, std::move(prefetched->script));
+				}
+				else
+				{
+					asset_repository
+						.addAsset(asset_name, createScript(engine, asset_path, asset_record));
 				}
-				else { script = new Scripting::EventLuaScript(engine, asset_path); }
-
-				asset_repository.addAsset(asset_name, std::shared_ptr<Scripting::ILuaScript>(script));
 			}
 		}
 
 		void loadSceneAssetEntry(
-			Engine*						 engine,
-			AssetRepository&			 asset_repository,
-			const nlohmann::json&		 asset_entry,
-			const std::filesystem::path& scene_path
+			Engine*							engine,
+			AssetRepository&				asset_repository,
+			const CompiledScene&			scene_data,
+			const SceneFormat::AssetRecord& asset_record,
+			const std::filesystem::path&	scene_path,
+			SceneLoader::PrefetchedAsset*	prefetched
 		)
 		{
-			AssetType asset_type =
-				EnumStringConvertor<AssetType>(asset_entry["type"].get<std::string>());
-
-			std::string			  asset_name = asset_entry["name"].get<std::string>();
+			std::string			  asset_name(scene_data.getString(asset_record.name));
 			std::filesystem::path asset_path = scene_path /
-											   asset_entry["location"].get<std::string>();
+											   scene_data.getString(asset_record.location);
 
 			asset_loader_fn_t loader_fn;
 
-			switch (asset_type)
+			switch (static_cast<AssetType>(asset_record.type))
 			{
 				case AssetType::TEXTURE:
 				{
@@ -209,13 +272,14 @@ namespace Engine
 				default:
 					throw ENGINE_EXCEPTION(std::format(
 						"Unknown type '{}' for asset '{}'",
-						asset_entry["type"].get<std::string>(),
+						asset_record.type,
 						asset_name
 					));
 			}
 
 			// Load the asset
-			loader_fn(engine, asset_repository, asset_name, asset_path, asset_entry);
+			PROFILE_ZONE_DYNAMIC(asset_name, "asset");
+			loader_fn(engine, asset_repository, asset_name, asset_path, asset_record, prefetched);
 		}
 
 	} // namespace
@@ -229,69 +293,224 @@ namespace Engine
 		this->logger->logSingle<decltype(this)>(Logging::LogLevel::VerboseDebug, "Destructor called");
 	}
 
-	std::shared_ptr<Scene> SceneLoader::loadScene(const std::string& scene_name)
+	void SceneLoader::prefetchScene(const std::string& scene_name, Base::JobSystem& job_system)
 	{
-		std::shared_ptr<Scene> new_scene = std::make_shared<Scene>(owner_engine);
+		PROFILE_ZONE_CATEGORY("SceneLoader::prefetchScene", "asset");
+
+		// The running prefetch still reads its scene data
+		if (prefetches.contains(scene_name)) { return; }
+
+		this->logger
+			->logSingle<decltype(this)>(Logging::LogLevel::Info, "Prefetching scene: '{}'", scene_name);
+
+		const std::filesystem::path scene_path = scene_prefix / scene_name;
+
+		auto  prefetch	   = std::make_unique<Prefetch>();
+		auto* prefetch_ptr = prefetch.get();
 
+		// Parsing the scene file is a job too, so that the caller never waits on disk access
+		prefetch->job = job_system.schedule([this, prefetch_ptr, scene_path, &job_system]() {
+			prefetch_ptr->data = openSceneFile(scene_path);
+
+			const size_t asset_count = prefetch_ptr->data->getAssets().size();
+			prefetch_ptr->assets.resize(asset_count);
+			prefetch_ptr->asset_count.store(asset_count);
+
+			// Every chunk writes only its own entries, no locking needed
+			prefetch_ptr->decode_job = job_system.parallelFor(
+				asset_count,
+				1,
+				[this, prefetch_ptr, scene_path](size_t begin, size_t end) {
+					const CompiledScene& scene_data = *prefetch_ptr->data;
+
+					for (size_t idx = begin; idx < end; idx++)
+					{
+						prefetch_ptr->assets[idx] = prefetchSceneAssetEntry(
+							owner_engine,
+							scene_data,
+							scene_data.getAssets()[idx],
+							scene_path
+						);
+						prefetch_ptr->decoded_count.fetch_add(1);
+					}
+				}
+			);
+		});
+
+		prefetches.emplace(scene_name, std::move(prefetch));
+	}
+
+	std::shared_ptr<Scene> SceneLoader::loadScene(const std::string& scene_name)
+	{
 		this->logger
 			->logSingle<decltype(this)>(Logging::LogLevel::Info, "Loading scene: '{}'", scene_name);
 
-		loadSceneInternal(new_scene, scene_name);
+		// Use the prefetched data if the scene was prefetched
+		std::unique_ptr<Prefetch> prefetch;
+		if (auto node = prefetches.extract(scene_name)) { prefetch = std::move(node.mapped()); }
+
+		if (prefetch)
+		{
+			try
+			{
+				PROFILE_ZONE_CATEGORY("SceneLoader::waitPrefetch", "asset");
+
+				auto* job_system = owner_engine->getJobSystem();
+				job_system->wait(prefetch->job);
+				job_system->wait(prefetch->decode_job);
+			}
+			catch (...)
+			{
+				std::throw_with_nested(ENGINE_EXCEPTION("Failed on scene prefetch"));
+			}
+		}
+		else
+		{
+			prefetch	   = std::make_unique<Prefetch>();
+			prefetch->data = openSceneFile(scene_prefix / scene_name);
+		}
+
+		loadSceneInternal(*prefetch, scene_name, std::chrono::nanoseconds::max());
+
+		return prefetch->scene;
+	}
+
+	std::shared_ptr<Scene>
+	SceneLoader::stepLoad(const std::string& scene_name, std::chrono::nanoseconds budget)
+	{
+		const auto prefetch = prefetches.find(scene_name);
+		EXCEPTION_ASSERT(
+			prefetch != prefetches.end(),
+			std::format("Scene '{}' was not prefetched!", scene_name)
+		);
+
+		if (!prefetch->second->isDone()) { return nullptr; }
+
+		checkPrefetch(*prefetch->second);
+
+		if (!loadSceneInternal(*prefetch->second, scene_name, budget)) { return nullptr; }
+
+		auto scene = std::move(prefetch->second->scene);
+		prefetches.erase(prefetch);
 
-		return new_scene;
+		return scene;
+	}
+
+	float SceneLoader::getLoadProgress(const std::string& scene_name) const
+	{
+		const auto prefetch = prefetches.find(scene_name);
+		if (prefetch == prefetches.end()) { return 1.0f; }
+
+		// Decoding and creating an asset count as one step each
+		const size_t asset_count = prefetch->second->asset_count.load();
+		if (asset_count == 0) { return prefetch->second->isDone() ? 1.0f : 0.0f; }
+
+		const size_t done_steps = prefetch->second->decoded_count.load() +
+								  prefetch->second->loaded_count;
+
+		return static_cast<float>(done_steps) / static_cast<float>(asset_count * 2);
 	}
 
 #pragma endregion
 
 #pragma region Protected
 
-	void SceneLoader::loadSceneInternal(std::shared_ptr<Scene>& scene, const std::string& scene_name)
+	std::unique_ptr<CompiledScene>
+	SceneLoader::openSceneFile(const std::filesystem::path& scene_path) const
 	{
+		const auto compiled_path = scene_path / SceneFormat::compiled_file_name;
+		const auto source_path	 = scene_path / SceneFormat::source_file_name;
+
+		// Failed queries return the earliest time, so a missing scene.json never wins
+		std::error_code error;
+		if (std::filesystem::exists(compiled_path, error) &&
+			std::filesystem::last_write_time(source_path, error) <=
+				std::filesystem::last_write_time(compiled_path, error))
+		{
+			// Without a scene.json, opening it reports why it can't be read
+			if (CompiledScene::isCurrentFormat(compiled_path) ||
+				!std::filesystem::exists(source_path, error))
+			{
+				return std::make_unique<CompiledScene>(compiled_path);
+			}
+
+			this->logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Warning,
+				"'{}' is not a compiled scene of format version {}, compiling '{}' instead",
+				compiled_path.string(),
+				SceneFormat::version,
+				source_path.string()
+			);
+		}
+
+		return std::make_unique<CompiledScene>(SceneCompiler::compileDirectory(scene_path));
+	}
+
+	bool SceneLoader::loadSceneInternal(
+		Prefetch&				 prefetch,
+		const std::string&		 scene_name,
+		std::chrono::nanoseconds budget
+	)
+	{
+		PROFILE_ZONE_CATEGORY("SceneLoader::loadSceneInternal", "asset");
+
 		const std::filesystem::path scene_path = scene_prefix / scene_name;
 
-		nlohmann::json data;
-		try
+		if (!prefetch.scene)
 		{
-			std::ifstream file(scene_path / "scene.json");
+			prefetch.scene = std::make_shared<Scene>(owner_engine);
 
-			data = nlohmann::json::parse(file);
+			this->logger->logSingle<decltype(this)>(
+				Logging::LogLevel::VerboseDebug,
+				"Loading scene prefix is: '{}' ({})",
+				scene_path.string(),
+				prefetch.data->isMapped() ? "compiled" : "compiled on load"
+			);
+		}
 
-			file.close();
+		try
+		{
+			if (!loadSceneAssets(prefetch, scene_path, budget)) { return false; }
+
+			loadSceneEventHandlers(*prefetch.data, prefetch.scene);
+			loadSceneTemplates(*prefetch.data, prefetch.scene);
 		}
 		catch (...)
 		{
-			std::throw_with_nested(ENGINE_EXCEPTION("Failed on json parse"));
+			std::throw_with_nested(ENGINE_EXCEPTION("Failed on scene load"));
 		}
 
-		this->logger->logSingle<decltype(this)>(
-			Logging::LogLevel::VerboseDebug,
-			"Loading scene prefix is: '{}'",
-			scene_path.string()
-		);
+		return true;
+	}
 
+	void SceneLoader::checkPrefetch(const Prefetch& prefetch)
+	{
 		try
 		{
-			loadSceneAssets(data, scene_path, scene);
-			loadSceneEventHandlers(data, scene);
-			loadSceneTemplates(data, scene);
+			// Finished jobs return right away or rethrow their exception
+			auto* job_system = owner_engine->getJobSystem();
+			job_system->wait(prefetch.job);
+			job_system->wait(prefetch.decode_job);
 		}
 		catch (...)
 		{
-			std::throw_with_nested(ENGINE_EXCEPTION("Failed on scene load"));
+			std::throw_with_nested(ENGINE_EXCEPTION("Failed on scene prefetch"));
 		}
 	}
 
-	void SceneLoader::loadSceneEventHandlers(const nlohmann::json& data, std::shared_ptr<Scene>& scene)
+	void SceneLoader::loadSceneEventHandlers(
+		const CompiledScene&	scene_data,
+		std::shared_ptr<Scene>& scene
+	)
 	{
 		// Load scene event handlers
-		for (const auto& event_handler_entry : data["event_handlers"])
+		for (const auto& event_handler_record : scene_data.getEventHandlers())
 		{
-			std::string event_handler_type = event_handler_entry["type"].get<std::string>();
-			std::string script_name		   = event_handler_entry["file"].get<std::string>();
-			std::string script_function	   = event_handler_entry["function"].get<std::string>();
+			std::string script_name(scene_data.getString(event_handler_record.script));
+			std::string script_function(scene_data.getString(event_handler_record.function));
 
-			EventHandling::EventType event_type =
-				EnumStringConvertor<EventHandling::EventType>(event_handler_type);
+			const auto event_type =
+				static_cast<EventHandling::EventType>(event_handler_record.event_type);
 
 			auto handler_script =
 				scene->asset_repository->getAsset<Scripting::ILuaScript>(script_name);
@@ -307,8 +526,9 @@ namespace Engine
 			scene->lua_event_handlers.emplace(
 				event_type,
 				Scripting::ScriptFunctionRef{
-					.script	  = handler_script.value(),
-					.function = script_function
+					.script	   = handler_script.value(),
+					.function  = script_function,
+					.zone_name = Base::Profiling::internName(script_function)
 				}
 			);
 		}
@@ -319,48 +539,45 @@ namespace Engine
 		);
 	}
 
-	void SceneLoader::loadSceneTemplates(const nlohmann::json& data, std::shared_ptr<Scene>& scene)
+	void SceneLoader::loadSceneTemplates(
+		const CompiledScene&	scene_data,
+		std::shared_ptr<Scene>& scene
+	)
 	{
+		using namespace Factories::ObjectFactory;
+
 		// Load scene object templates
-		for (const auto& entry : data["templates"])
+		for (const auto& record : scene_data.getTemplates())
 		{
-			Factories::ObjectFactory::ObjectTemplate obj_template = {
-				.with_renderer			 = entry["renderer"].get<std::string>(),
-				.with_mesh_builder		 = entry["mesh_builder"].get<std::string>(),
-				.with_shader			 = entry["shader_name"].get<std::string>(),
+			ObjectTemplate obj_template = {
+				.with_renderer			 = static_cast<RendererType>(record.renderer),
+				.with_mesh_builder		 = static_cast<MeshBuilderType>(record.mesh_builder),
+				.with_shader			 = std::string(scene_data.getString(record.shader)),
 				.renderer_supply_list	 = {},
 				.meshbuilder_supply_list = {}
 			};
-			std::string name = entry["name"].get<std::string>();
+			std::string name(scene_data.getString(record.name));
 
-			for (const auto& supply_entry : entry["renderer_supply_data"])
+			for (const auto& supply_record : scene_data.getSupplyData(record.renderer_supply))
 			{
-				EnumStringConvertor<Rendering::RendererSupplyData::Type> type =
-					supply_entry[0].get<std::string>();
-
-				std::string val = supply_entry[1].get<std::string>();
+				using supply_data_t = Rendering::RendererSupplyData;
 
-				obj_template.renderer_supply_list.emplace_back(
-					interpretSupplyData<Rendering::RendererSupplyData>(
-						*scene->asset_repository,
-						type,
-						val
-					)
-				);
+				obj_template.renderer_supply_list.emplace_back(interpretSupplyData<supply_data_t>(
+					*scene->asset_repository,
+					static_cast<supply_data_t::Type>(supply_record.type),
+					std::string(scene_data.getString(supply_record.value))
+				));
 			}
 
-			for (const auto& supply_entry : entry["meshbuilder_supply_data"])
+			for (const auto& supply_record : scene_data.getSupplyData(record.meshbuilder_supply))
 			{
-				EnumStringConvertor<Rendering::MeshBuilderSupplyData::Type> type =
-					supply_entry[0].get<std::string>();
-
-				std::string val = supply_entry[1].get<std::string>();
+				using supply_data_t = Rendering::MeshBuilderSupplyData;
 
 				obj_template.meshbuilder_supply_list.emplace_back(
-					interpretSupplyData<Rendering::MeshBuilderSupplyData>(
+					interpretSupplyData<supply_data_t>(
 						*scene->asset_repository,
-						type,
-						val
+						static_cast<supply_data_t::Type>(supply_record.type),
+						std::string(scene_data.getString(supply_record.value))
 					)
 				);
 			}
@@ -377,28 +594,58 @@ namespace Engine
 		this->logger->logSingle<decltype(this)>(Logging::LogLevel::Debug, "Done stage: Templates");
 	}
 
-	void SceneLoader::loadSceneAssets(
-		const nlohmann::json&		 data,
+	bool SceneLoader::loadSceneAssets(
+		Prefetch&					 prefetch,
 		const std::filesystem::path& scene_path,
-		std::shared_ptr<Scene>&		 scene
+		std::chrono::nanoseconds	 budget
 	)
 	{
-		for (const auto& asset_entry : data["assets"])
+		const auto start = std::chrono::steady_clock::now();
+
+		const CompiledScene& scene_data	   = *prefetch.data;
+		const auto			 asset_records = scene_data.getAssets();
+
+		// Scenes loaded without a prefetch have no prefetched assets
+		const bool is_prefetched = !prefetch.assets.empty();
+
+		while (prefetch.loaded_count < asset_records.size())
 		{
+			const size_t idx		  = prefetch.loaded_count;
+			const auto&	 asset_record = asset_records[idx];
+
 			try
 			{
-				loadSceneAssetEntry(owner_engine, *scene->asset_repository, asset_entry, scene_path);
+				loadSceneAssetEntry(
+					owner_engine,
+					*prefetch.scene->asset_repository,
+					scene_data,
+					asset_record,
+					scene_path,
+					is_prefetched ? &prefetch.assets[idx] : nullptr
+				);
 			}
 			catch (...)
 			{
 				std::throw_with_nested(ENGINE_EXCEPTION(std::format(
-					"Exception occured loading asset! Relevant JSON:\n'{}'",
-					asset_entry.dump(4)
+					"Exception occured loading asset '{}' from '{}'!",
+					scene_data.getString(asset_record.name),
+					scene_data.getString(asset_record.location)
 				)));
 			}
+
+			prefetch.loaded_count++;
+
+			// At least one asset is loaded per call
+			if (std::chrono::steady_clock::now() - start >= budget &&
+				prefetch.loaded_count < asset_records.size())
+			{
+				return false;
+			}
 		}
 
 		this->logger->logSingle<decltype(this)>(Logging::LogLevel::Debug, "Done stage: Assets");
+
+		return true;
 	}
 
 #pragma endregion
@@ -1,6 +1,7 @@
 #include "SceneManager.hpp"
 
-#include "Rendering/Renderers/Renderer.hpp"
+#include "Rendering/Vulkan/backend.hpp"
+#include "Rendering/Vulkan/rendering.hpp"
 
 #include "Logging/Logging.hpp"
 
@@ -9,6 +10,7 @@
 #include "Exception.hpp"
 #include "InternalEngineObject.hpp"
 #include "Scene.hpp"
+#include "SceneBudget.hpp"
 #include "SceneLoader.hpp"
 #include "TimeMeasure.hpp"
 
@@ -19,9 +21,12 @@
 #include <cassert>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <exception>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace Engine
 {
@@ -47,22 +52,35 @@ namespace Engine
 		scene_loader.reset();
 	}
 
-	void SceneManager::onCameraUpdated()
+	void SceneManager::setSceneLoadPrefix(const std::string& scene_prefix)
 	{
-		// Explicitly update matrices of all objects
-		// since otherwise they'd update them only on transform updates
-		for (const auto& [name, ptr] : current_scene->getAllObjects())
-		{
-			auto* object_renderer = static_cast<Rendering::IRenderer*>(ptr->getRenderer());
-			assert(object_renderer != nullptr);
+		scene_loader->scene_prefix = scene_prefix;
+	}
+
+	void SceneManager::prefetchScene(const std::string& scene_name)
+	{
+		if (scenes.contains(scene_name)) { return; }
+
+		auto* job_system = owner_engine->getJobSystem();
+		assert(job_system);
 
-			object_renderer->updateMatrices();
+		try
+		{
+			scene_loader->prefetchScene(scene_name, *job_system);
+		}
+		catch (...)
+		{
+			std::throw_with_nested(ENGINE_EXCEPTION("Exception occured during prefetchScene"));
 		}
 	}
 
-	void SceneManager::setSceneLoadPrefix(const std::string& scene_prefix)
+	void SceneManager::preloadScene(const std::string& scene_name)
 	{
-		scene_loader->scene_prefix = scene_prefix;
+		const bool is_preloading = std::ranges::find(preloading, scene_name) != preloading.end();
+		if (scenes.contains(scene_name) || is_preloading) { return; }
+
+		prefetchScene(scene_name);
+		preloading.push_back(scene_name);
 	}
 
 	/**
@@ -70,6 +88,9 @@ namespace Engine
 	 */
 	void SceneManager::loadScene(const std::string& scene_name)
 	{
+		// Loading creates textures, which must not happen while a frame is drawn
+		owner_engine->syncRenderThread();
+
 		try
 		{
 			scenes.emplace(scene_name, scene_loader->loadScene(scene_name));
@@ -78,16 +99,33 @@ namespace Engine
 		{
 			std::throw_with_nested(ENGINE_EXCEPTION("Exception occured during loadScene"));
 		}
+
+		// Finished here instead of by update()
+		std::erase(preloading, scene_name);
+
+		// The budget is enforced once a scene is switched to, until then this one is kept
+		if (scenes.at(scene_name) != current_scene) { awaiting_activation.insert(scene_name); }
+		markUsed(scene_name);
 	}
 
 	void SceneManager::setScene(const std::string& scene_name)
 	{
-		// Try loading the scene if it isn't loaded
+		// Keep the current scene running until the new one is resident
 		if (!scenes.contains(scene_name))
 		{
-			loadScene(scene_name);
+			preloadScene(scene_name);
+			pending_scene = scene_name;
+
+			logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Info,
+				"Scene '{}' is not resident yet, switching once it is loaded",
+				scene_name
+			);
+			return;
 		}
 
+		pending_scene.clear();
+
 		logger->logSingle<decltype(this)>(
 			Logging::LogLevel::Info,
 			"Switching to scene '{}'",
@@ -99,6 +137,11 @@ namespace Engine
 
 		current_scene = scenes[scene_name];
 		asset_manager->setSceneRepository(current_scene->asset_repository.get());
+		awaiting_activation.erase(scene_name);
+		markUsed(scene_name);
+
+		// Recorded sessions replay the same random numbers
+		owner_engine->seedScriptRandom(*current_scene);
 
 		// Measure init event time
 		TIMEMEASURE_START(oninit);
@@ -116,6 +159,9 @@ namespace Engine
 			"onInit event took {:.3f}ms",
 			oninit_total.count()
 		);
+
+		// The previous scene is inactive now
+		enforceMemoryBudget();
 	}
 
 	std::shared_ptr<Scene> SceneManager::getSceneCurrent()
@@ -125,6 +171,111 @@ namespace Engine
 		return current_scene;
 	}
 
+	void SceneManager::update()
+	{
+		if (preloading.empty()) { return; }
+
+		const auto deadline = std::chrono::steady_clock::now() + load_step_budget;
+
+		for (size_t idx = 0; idx < preloading.size();)
+		{
+			const auto remaining = deadline - std::chrono::steady_clock::now();
+			if (remaining <= std::chrono::steady_clock::duration::zero()) { break; }
+
+			// Copied, event handlers below may preload more scenes
+			const std::string scene_name = preloading[idx];
+
+			std::shared_ptr<Scene> scene;
+			try
+			{
+				scene = scene_loader->stepLoad(
+					scene_name,
+					std::chrono::duration_cast<std::chrono::nanoseconds>(remaining)
+				);
+			}
+			catch (...)
+			{
+				preloading.erase(preloading.begin() + static_cast<std::ptrdiff_t>(idx));
+				if (pending_scene == scene_name) { pending_scene.clear(); }
+
+				std::throw_with_nested(ENGINE_EXCEPTION("Exception occured during preloadScene"));
+			}
+
+			if (!scene)
+			{
+				idx++;
+				continue;
+			}
+
+			preloading.erase(preloading.begin() + static_cast<std::ptrdiff_t>(idx));
+			scenes.emplace(scene_name, std::move(scene));
+			awaiting_activation.insert(scene_name);
+			markUsed(scene_name);
+
+			logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Info,
+				"Scene '{}' is resident",
+				scene_name
+			);
+
+			// The scene that is still current is told, it may switch to the loaded scene
+			auto event =
+				EventHandling::Event(owner_engine, EventHandling::EventType::onSceneLoaded);
+			event.scene_name = scene_name;
+
+			const int loaded_ret = owner_engine->fireEvent(event);
+			EXCEPTION_ASSERT(loaded_ret == 0, "onSceneLoaded Event returned non-zero!");
+
+			if (pending_scene == scene_name) { setScene(scene_name); }
+		}
+	}
+
+	float SceneManager::getLoadProgress(const std::string& scene_name) const
+	{
+		if (scenes.contains(scene_name)) { return 1.0f; }
+
+		if (std::ranges::find(preloading, scene_name) == preloading.end()) { return 0.0f; }
+
+		return scene_loader->getLoadProgress(scene_name);
+	}
+
+	void SceneManager::setMemoryBudget(size_t cpu_bytes, size_t gpu_bytes)
+	{
+		memory_budget = {.cpu_bytes = cpu_bytes, .gpu_bytes = gpu_bytes};
+
+		enforceMemoryBudget();
+	}
+
+	void SceneManager::pinScene(const std::string& scene_name)
+	{
+		pinned_scenes.insert(scene_name);
+	}
+
+	void SceneManager::unpinScene(const std::string& scene_name)
+	{
+		pinned_scenes.erase(scene_name);
+
+		enforceMemoryBudget();
+	}
+
+	std::vector<SceneManager::SceneMemoryReport> SceneManager::getMemoryReport() const
+	{
+		std::vector<SceneMemoryReport> report;
+		report.reserve(scenes.size());
+
+		for (const auto& [name, scene] : scenes)
+		{
+			report.push_back(
+				{.name		 = name,
+				 .usage		 = scene->getMemoryUsage(),
+				 .is_current = scene == current_scene,
+				 .is_pinned	 = pinned_scenes.contains(name)}
+			);
+		}
+
+		return report;
+	}
+
 	glm::vec3 SceneManager::getLightTransform()
 	{
 		return light_position;
@@ -171,7 +322,7 @@ namespace Engine
 		return glm::ortho(0.0f, 1.0f, 0.0f, 1.0f);
 	}
 
-	glm::mat4 SceneManager::getCameraViewMatrix()
+	glm::mat4 SceneManager::getCameraViewMatrix() const
 	{
 		float yaw	= glm::radians(camera_hv_rotation.x);
 		float pitch = glm::radians(camera_hv_rotation.y);
@@ -194,10 +345,17 @@ namespace Engine
 		return view_matrix;
 	}
 
+	Rendering::FrameUniformData SceneManager::getFrameUniformData() const
+	{
+		return {
+			.mat_vp		  = getProjectionMatrix() * getCameraViewMatrix(),
+			.mat_vp_ortho = getProjectionMatrixOrtho()
+		};
+	}
+
 	void SceneManager::setCameraTransform(glm::vec3 transform)
 	{
 		camera_transform = transform;
-		onCameraUpdated();
 	}
 
 	void SceneManager::setCameraRotation(glm::vec2 hvrotation)
@@ -233,6 +391,66 @@ namespace Engine
 		}
 
 		camera_hv_rotation = hvrotation;
-		onCameraUpdated();
+	}
+
+	void SceneManager::markUsed(const std::string& scene_name)
+	{
+		last_used[scene_name] = ++use_counter;
+	}
+
+	void SceneManager::enforceMemoryBudget()
+	{
+		if (memory_budget.cpu_bytes == 0 && memory_budget.gpu_bytes == 0) { return; }
+
+		// Nothing is active yet, every resident scene is still waiting to be switched to
+		if (!current_scene) { return; }
+
+		std::vector<SceneBudgetEntry> entries;
+		entries.reserve(scenes.size());
+
+		MemoryUsage total;
+		for (const auto& report : getMemoryReport())
+		{
+			const auto found = last_used.find(report.name);
+
+			entries.push_back(
+				{.name			= report.name,
+				 .usage			= report.usage,
+				 .last_used		= found != last_used.end() ? found->second : 0,
+				 .is_unloadable = !report.is_current && !report.is_pinned &&
+								  !awaiting_activation.contains(report.name)}
+			);
+			total += report.usage;
+		}
+
+		auto* deletion_queue = owner_engine->getVulkanInstance()->getDeletionQueue();
+
+		for (const auto& entry : selectScenesToUnload(std::move(entries), memory_budget))
+		{
+			logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Info,
+				"Unloading scene '{}' over memory budget (CPU {} KiB, GPU {} KiB)",
+				entry.name,
+				entry.usage.cpu_bytes / 1024,
+				entry.usage.gpu_bytes / 1024
+			);
+
+			auto node = scenes.extract(entry.name);
+			last_used.erase(entry.name);
+			total -= entry.usage;
+
+			// Frames in flight may still draw the scene's objects
+			deletion_queue->retire(std::move(node.mapped()));
+		}
+
+		if (isOverBudget(total, memory_budget))
+		{
+			logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Warning,
+				"Resident scenes exceed the memory budget (CPU {} KiB, GPU {} KiB)",
+				total.cpu_bytes / 1024,
+				total.gpu_bytes / 1024
+			);
+		}
 	}
 } // namespace Engine
@@ -6,9 +6,13 @@
 
 #include "Logging/Logging.hpp"
 
+#include "Exception.hpp"
 #include "InternalEngineObject.hpp"
+#include "ObjectStorage.hpp"
 
-#include <cassert>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 
 namespace Engine
 {
@@ -28,87 +32,96 @@ namespace Engine
 	{
 		this->logger->logSingle<decltype(this)>(Logging::LogLevel::VerboseDebug, "Destructor called");
 
-		delete renderer;
-	}
+		removeChildren();
+		if (parent != nullptr) { std::erase(parent->children, this); }
 
-	void SceneObject::updateRenderer()
-	{
-		assert(renderer);
-
-		renderer->updateTransform(transform, parent_transform);
+		delete renderer;
 	}
 
 	void SceneObject::setPosition(const glm::vec3& with_pos)
 	{
-		transform.pos = with_pos;
-		updateRenderer();
-
-		for (auto& child : children)
-		{
-			child->setParentTransform(transform);
-			child->updateRenderer();
-		}
+		if (storage != nullptr) { storage->setPosition(handle, with_pos); }
+		else { transform.pos = with_pos; }
 	}
 
 	void SceneObject::setSize(const glm::vec3& with_size)
 	{
-		transform.size = with_size;
-		updateRenderer();
-
-		for (auto& child : children)
-		{
-			child->setParentTransform(transform);
-			child->updateRenderer();
-		}
+		if (storage != nullptr) { storage->setSize(handle, with_size); }
+		else { transform.size = with_size; }
 	}
 
 	void SceneObject::setRotation(const glm::vec3& with_rotation)
 	{
-		transform.rotation = with_rotation;
-
-		updateRenderer();
-
-		for (auto& child : children)
-		{
-			child->setParentTransform(transform);
-			child->updateRenderer();
-		}
+		if (storage != nullptr) { storage->setRotation(handle, with_rotation); }
+		else { transform.rotation = with_rotation; }
 	}
 
 	glm::vec3 SceneObject::getPosition() const noexcept
 	{
-		return transform.pos;
+		return getTransform().pos;
 	}
 	glm::vec3 SceneObject::getSize() const noexcept
 	{
-		return transform.size;
+		return getTransform().size;
 	}
 	glm::vec3 SceneObject::getRotation() const noexcept
 	{
-		return transform.rotation;
+		return getTransform().rotation;
+	}
+
+	void SceneObject::setLayer(int with_layer)
+	{
+		if (renderer != nullptr)
+		{
+			renderer->setLayer(static_cast<uint8_t>(std::clamp(with_layer, 0, 255)));
+		}
 	}
 
-	void SceneObject::setParentTransform(const Rendering::Transform& with_parent_transform)
+	int SceneObject::getLayer() const noexcept
 	{
-		parent_transform = with_parent_transform;
+		return renderer != nullptr ? renderer->getLayer() : 0;
 	}
 
 	void SceneObject::addChild(SceneObject* with_child)
 	{
 		with_child->setParent(this);
-		with_child->setParentTransform(transform);
-		with_child->updateRenderer();
-
-		children.push_back(with_child);
 	}
 
 	void SceneObject::removeChildren()
 	{
+		for (auto* child : children)
+		{
+			child->parent = nullptr;
+			child->markTransformDirty();
+		}
+
 		children.clear();
 	}
 
 	void SceneObject::setParent(SceneObject* with_parent)
 	{
+		if (with_parent == parent) { return; }
+
+		for (const auto* ancestor = with_parent; ancestor != nullptr; ancestor = ancestor->parent)
+		{
+			EXCEPTION_ASSERT(ancestor != this, "Object cannot be a descendant of itself!");
+		}
+
+		if (parent != nullptr) { std::erase(parent->children, this); }
+
 		parent = with_parent;
+		if (parent != nullptr) { parent->children.push_back(this); }
+
+		markTransformDirty();
+	}
+
+	Rendering::Transform SceneObject::getTransform() const
+	{
+		return storage != nullptr ? storage->getTransform(handle) : transform;
+	}
+
+	void SceneObject::markTransformDirty()
+	{
+		if (storage != nullptr) { storage->markDirty(handle); }
 	}
 } // namespace Engine
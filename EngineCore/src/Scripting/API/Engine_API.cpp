@@ -2,11 +2,15 @@
 
 #include "Scripting/API/CallGenerator.hpp"
 #include "Scripting/API/framework.hpp"
+#include "Scripting/LuaValue.hpp"
 
 #include "Engine.hpp"
+#include "EnumStringConvertor.hpp"
+#include "FrameStats.hpp"
 #include "lua.hpp"
 
 #include <cassert>
+#include <cstddef>
 #include <string>
 #include <unordered_map>
 
@@ -64,6 +68,63 @@ namespace Engine::Scripting::API
 			return 0;
 		} */
 
+		GENERATED_LAMBDA_MEMBER_CALL(Engine, getInterpolationAlpha)
+
+		GENERATED_LAMBDA_MEMBER_CALL(Engine, getIdleUtilisation)
+
+		GENERATED_LAMBDA_MEMBER_CALL(Engine, getIdleSlack)
+
+		GENERATED_LAMBDA_MEMBER_CALL(Engine, isKeyDown)
+
+		GENERATED_LAMBDA_MEMBER_CALL(Engine, getMouseDelta)
+
+		GENERATED_LAMBDA_MEMBER_CALL(Engine, writeTrace)
+
+		GENERATED_LAMBDA_MEMBER_CALL(Engine, writeFrameStats)
+
+		GENERATED_LAMBDA_MEMBER_CALL(Engine, setStatCounter)
+
+		int getFrameStats(lua_State* state)
+		{
+			CMEP_LUACHECK_FN_ARGC(state, 2)
+			CMEP_LUAGET_PTR(state, Engine)
+
+			const FrameStats::Metric metric =
+				EnumStringConvertor<FrameStats::Metric>(static_cast<std::string>(LuaValue(state, 2)));
+
+			const auto& frame_stats = self->getFrameStats();
+			const auto	summary		= frame_stats.getSummary(metric);
+
+			lua_createtable(state, 0, 8);
+
+			lua_pushnumber(state, summary.p50);
+			lua_setfield(state, -2, "p50");
+			lua_pushnumber(state, summary.p95);
+			lua_setfield(state, -2, "p95");
+			lua_pushnumber(state, summary.p99);
+			lua_setfield(state, -2, "p99");
+			lua_pushnumber(state, summary.max);
+			lua_setfield(state, -2, "max");
+			lua_pushnumber(state, summary.mean);
+			lua_setfield(state, -2, "mean");
+
+			lua_pushnumber(state, static_cast<lua_Number>(frame_stats.getFrameCount()));
+			lua_setfield(state, -2, "frames");
+			lua_pushnumber(state, static_cast<lua_Number>(frame_stats.getOverBudgetCount()));
+			lua_setfield(state, -2, "overBudget");
+
+			const auto histogram = frame_stats.getHistogram();
+			lua_createtable(state, static_cast<int>(histogram.size()), 0);
+			for (size_t idx = 0; idx < histogram.size(); idx++)
+			{
+				lua_pushinteger(state, static_cast<lua_Integer>(histogram[idx]));
+				lua_rawseti(state, -2, static_cast<int>(idx + 1));
+			}
+			lua_setfield(state, -2, "histogram");
+
+			return 1;
+		}
+
 		GENERATED_LAMBDA_MEMBER_CALL(Engine, stop)
 
 		/* int stop(lua_State* state)
@@ -82,6 +143,15 @@ namespace Engine::Scripting::API
 		CMEP_LUAMAPPING_DEFINE(getAssetManager),
 		CMEP_LUAMAPPING_DEFINE(getSceneManager),
 		CMEP_LUAMAPPING_DEFINE(setFramerateTarget),
+		CMEP_LUAMAPPING_DEFINE(getInterpolationAlpha),
+		CMEP_LUAMAPPING_DEFINE(getIdleUtilisation),
+		CMEP_LUAMAPPING_DEFINE(getIdleSlack),
+		CMEP_LUAMAPPING_DEFINE(isKeyDown),
+		CMEP_LUAMAPPING_DEFINE(getMouseDelta),
+		CMEP_LUAMAPPING_DEFINE(writeTrace),
+		CMEP_LUAMAPPING_DEFINE(writeFrameStats),
+		CMEP_LUAMAPPING_DEFINE(setStatCounter),
+		CMEP_LUAMAPPING_DEFINE(getFrameStats),
 		CMEP_LUAMAPPING_DEFINE(stop),
 	};
 } // namespace Engine::Scripting::API
@@ -9,6 +9,8 @@
 #include "Scripting/API/Scene_API.hpp"
 
 #include "Engine.hpp"
+#include "Exception.hpp"
+#include "ObjectStorage.hpp"
 #include "Scene.hpp"
 #include "SceneManager.hpp"
 #include "SceneObject.hpp"
@@ -151,5 +153,29 @@ namespace Engine::Scripting::API::LuaFactories
 		lua_pushlightuserdata(state, object_ptr);
 		lua_setfield(state, -2, "_ptr");
 	}
+
+	void sceneObjectFactory(lua_State* state, Scene* scene, ObjectHandle handle)
+	{
+		auto* object = CHECK(scene->getObject(handle));
+
+		templatedFactory<SceneObject>(state, object);
+		attachObjectHandle(state, lua_gettop(state), scene, handle);
+	}
+
+	void attachObjectHandle(lua_State* state, int index, Scene* scene, ObjectHandle handle)
+	{
+		assert(lua_istable(state, index) == true);
+
+		// Packed handles fit into a lua_Number exactly
+		lua_pushnumber(state, static_cast<lua_Number>(handle.pack()));
+		lua_setfield(state, index, "_handle");
+
+		lua_pushlightuserdata(state, scene);
+		lua_setfield(state, index, "_scene");
+
+		// The pointer must not be used anymore, the object may be removed by the scene
+		lua_pushnil(state);
+		lua_setfield(state, index, "_ptr");
+	}
 	/// @endcond
 } // namespace Engine::Scripting::API::LuaFactories
@@ -2,10 +2,15 @@
 
 #include "Scripting/API/CallGenerator.hpp"
 #include "Scripting/API/framework.hpp"
+#include "Scripting/LuaValue.hpp"
 
+#include "Exception.hpp"
+#include "ObjectStorage.hpp"
+#include "Scene.hpp"
 #include "SceneObject.hpp"
 #include "lua.hpp"
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 
@@ -21,10 +26,49 @@ namespace Engine::Scripting::API
 		GENERATED_LAMBDA_MEMBER_CALL(SceneObject, setSize)
 		GENERATED_LAMBDA_MEMBER_CALL(SceneObject, getPosition)
 		GENERATED_LAMBDA_MEMBER_CALL(SceneObject, setPosition)
+		GENERATED_LAMBDA_MEMBER_CALL(SceneObject, getLayer)
+		GENERATED_LAMBDA_MEMBER_CALL(SceneObject, setLayer)
 
 	} // namespace
 	/// @endcond
 
+} // namespace Engine::Scripting::API
+
+namespace Engine::Scripting
+{
+	template <>
+	SceneObject* getObjectAsPointer<SceneObject>(lua_State* state, int index)
+	{
+		// Relative indices would shift with every value pushed below
+		if (index < 0) { index = lua_gettop(state) + index + 1; }
+
+		lua_getfield(state, index, "_handle");
+
+		// Objects not yet added to a scene are still referenced by pointer
+		if (lua_isnil(state, -1))
+		{
+			lua_pop(state, 1);
+
+			auto val = UNWRAP(LuaValue(state, index)["_ptr"]);
+			return CHECK(static_cast<SceneObject*>(val));
+		}
+
+		const auto packed = static_cast<uint64_t>(lua_tonumber(state, -1));
+		lua_pop(state, 1);
+
+		lua_getfield(state, index, "_scene");
+		auto* scene = static_cast<Scene*>(lua_touserdata(state, -1));
+		lua_pop(state, 1);
+
+		auto* object = CHECK(scene)->getObject(ObjectHandle::unpack(packed));
+		EXCEPTION_ASSERT(object != nullptr, "Object was removed from its scene!");
+
+		return object;
+	}
+} // namespace Engine::Scripting
+
+namespace Engine::Scripting::API
+{
 	std::unordered_map<std::string, const lua_CFunction> object_mappings = {
 		CMEP_LUAMAPPING_DEFINE(addChild),
 		CMEP_LUAMAPPING_DEFINE(getSize),
@@ -32,6 +76,8 @@ namespace Engine::Scripting::API
 		CMEP_LUAMAPPING_DEFINE(getRotation),
 		CMEP_LUAMAPPING_DEFINE(setRotation),
 		CMEP_LUAMAPPING_DEFINE(getPosition),
-		CMEP_LUAMAPPING_DEFINE(setPosition)
+		CMEP_LUAMAPPING_DEFINE(setPosition),
+		CMEP_LUAMAPPING_DEFINE(getLayer),
+		CMEP_LUAMAPPING_DEFINE(setLayer)
 	};
 } // namespace Engine::Scripting::API
@@ -22,6 +22,10 @@ namespace Engine::Scripting::API
 		GENERATED_LAMBDA_MEMBER_CALL(SceneManager, setLightTransform);
 		GENERATED_LAMBDA_MEMBER_CALL(SceneManager, getSceneCurrent);
 		GENERATED_LAMBDA_MEMBER_CALL(SceneManager, setScene);
+		GENERATED_LAMBDA_MEMBER_CALL(SceneManager, preloadScene);
+		GENERATED_LAMBDA_MEMBER_CALL(SceneManager, getLoadProgress);
+		GENERATED_LAMBDA_MEMBER_CALL(SceneManager, pinScene);
+		GENERATED_LAMBDA_MEMBER_CALL(SceneManager, unpinScene);
 	} // namespace
 	/// @endcond
 
@@ -36,6 +40,11 @@ namespace Engine::Scripting::API
 		CMEP_LUAMAPPING_DEFINE(setLightTransform),
 
 		CMEP_LUAMAPPING_DEFINE(getSceneCurrent),
-		CMEP_LUAMAPPING_DEFINE(setScene)
+		CMEP_LUAMAPPING_DEFINE(setScene),
+		CMEP_LUAMAPPING_DEFINE(preloadScene),
+		CMEP_LUAMAPPING_DEFINE(getLoadProgress),
+
+		CMEP_LUAMAPPING_DEFINE(pinScene),
+		CMEP_LUAMAPPING_DEFINE(unpinScene)
 	};
 } // namespace Engine::Scripting::API
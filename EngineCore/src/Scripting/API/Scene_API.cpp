@@ -2,25 +2,79 @@
 
 #include "Scripting/API/CallGenerator.hpp"
 #include "Scripting/API/LuaFactories.hpp"
+#include "Scripting/API/ValueHandler.hpp"
 #include "Scripting/API/framework.hpp"
 #include "Scripting/LuaValue.hpp"
 
 #include "Exception.hpp"
+#include "ObjectStorage.hpp"
 #include "Scene.hpp"
 #include "SceneObject.hpp"
+#include "SpatialIndex.hpp"
+#include "glm/vec3.hpp"
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Engine::Scripting::API
 {
 	/// @cond LUA_API
 	namespace
 	{
-		GENERATED_LAMBDA_MEMBER_CALL(Scene, addObject)
-		GENERATED_LAMBDA_MEMBER_CALL(Scene, findObject)
 		GENERATED_LAMBDA_MEMBER_CALL(Scene, removeObject)
 
+		/**
+		 * Push an array of object tables, one per handle
+		 */
+		void pushObjectArray(lua_State* state, Scene* scene, const std::vector<ObjectHandle>& handles)
+		{
+			lua_createtable(state, static_cast<int>(handles.size()), 0);
+
+			for (size_t idx = 0; idx < handles.size(); idx++)
+			{
+				API::LuaFactories::sceneObjectFactory(state, scene, handles[idx]);
+				lua_rawseti(state, -2, static_cast<int>(idx + 1));
+			}
+		}
+
+		int addObject(lua_State* state)
+		{
+			CMEP_LUACHECK_FN_ARGC(state, 3)
+
+			auto* scene = getObjectAsPointer<Scene>(state, 1);
+
+			std::string name   = LuaValue(state, 2);
+			auto*		object = getObjectAsPointer<SceneObject>(state, 3);
+
+			const ObjectHandle handle = scene->addObject(name, object);
+
+			// The table passed in now refers to the object by handle
+			API::LuaFactories::attachObjectHandle(state, 3, scene, handle);
+
+			return 0;
+		}
+
+		int findObject(lua_State* state)
+		{
+			CMEP_LUACHECK_FN_ARGC(state, 2)
+
+			auto* scene = getObjectAsPointer<Scene>(state, 1);
+
+			std::string name = LuaValue(state, 2);
+
+			const ObjectHandle handle = scene->findHandle(name);
+			if (!handle.isValid())
+			{
+				lua_pushnil(state);
+				return 1;
+			}
+
+			API::LuaFactories::sceneObjectFactory(state, scene, handle);
+
+			return 1;
+		}
+
 		int addTemplatedObject(lua_State* state)
 		{
 			CMEP_LUACHECK_FN_ARGC(state, 3)
@@ -30,12 +84,63 @@ namespace Engine::Scripting::API
 			std::string name		  = LuaValue(state, 2);
 			std::string template_name = LuaValue(state, 3);
 
-			scene->addTemplatedObject(name, template_name);
-			SceneObject* obj = scene->findObject(name);
+			const ObjectHandle handle = scene->addTemplatedObject(name, template_name);
+
+			API::LuaFactories::sceneObjectFactory(state, scene, handle);
+
+			return 1;
+		}
+
+		int queryRadius(lua_State* state)
+		{
+			CMEP_LUACHECK_FN_ARGC(state, 6)
+
+			auto* scene = getObjectAsPointer<Scene>(state, 1);
+
+			const auto				 space	= get_handler_t<SpatialIndex::Space>::get(state, 2);
+			const auto				 center = get_handler_t<glm::vec3>::get(state, 3);
+			const LuaValue::number_t radius = LuaValue(state, 6);
+
+			pushObjectArray(
+				state,
+				scene,
+				scene->queryRadius(space, center, static_cast<float>(radius))
+			);
+
+			return 1;
+		}
+
+		int queryAABB(lua_State* state)
+		{
+			CMEP_LUACHECK_FN_ARGC(state, 8)
+
+			auto* scene = getObjectAsPointer<Scene>(state, 1);
+
+			const auto space = get_handler_t<SpatialIndex::Space>::get(state, 2);
+			const auto min	 = get_handler_t<glm::vec3>::get(state, 3);
+			const auto max	 = get_handler_t<glm::vec3>::get(state, 6);
+
+			pushObjectArray(state, scene, scene->queryAABB(space, min, max));
+
+			return 1;
+		}
+
+		int queryRay(lua_State* state)
+		{
+			CMEP_LUACHECK_FN_ARGC(state, 9)
+
+			auto* scene = getObjectAsPointer<Scene>(state, 1);
 
-			EXCEPTION_ASSERT(obj != nullptr, "Templated object could not be added");
+			const auto				 space		  = get_handler_t<SpatialIndex::Space>::get(state, 2);
+			const auto				 origin		  = get_handler_t<glm::vec3>::get(state, 3);
+			const auto				 direction	  = get_handler_t<glm::vec3>::get(state, 6);
+			const LuaValue::number_t max_distance = LuaValue(state, 9);
 
-			API::LuaFactories::templatedFactory<SceneObject>(state, obj);
+			pushObjectArray(
+				state,
+				scene,
+				scene->queryRay(space, origin, direction, static_cast<float>(max_distance))
+			);
 
 			return 1;
 		}
@@ -46,6 +151,9 @@ namespace Engine::Scripting::API
 		CMEP_LUAMAPPING_DEFINE(addObject),
 		CMEP_LUAMAPPING_DEFINE(findObject),
 		CMEP_LUAMAPPING_DEFINE(removeObject),
-		CMEP_LUAMAPPING_DEFINE(addTemplatedObject)
+		CMEP_LUAMAPPING_DEFINE(addTemplatedObject),
+		CMEP_LUAMAPPING_DEFINE(queryRadius),
+		CMEP_LUAMAPPING_DEFINE(queryAABB),
+		CMEP_LUAMAPPING_DEFINE(queryRay)
 	};
 } // namespace Engine::Scripting::API
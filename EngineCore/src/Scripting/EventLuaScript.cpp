@@ -5,6 +5,7 @@
 
 #include "EventHandling.hpp"
 
+#include <span>
 #include <string>
 
 namespace Engine::Scripting
@@ -21,6 +22,46 @@ namespace Engine::Scripting
 		lua_getglobal(state, function.c_str());
 	}
 
+	void EventLuaScript::pushInputs(std::span<const EventHandling::InputEvent> inputs)
+	{
+		using input_type_t = EventHandling::InputEvent::Type;
+
+		lua_createtable(state, static_cast<int>(inputs.size()), 0);
+
+		int index = 1;
+		for (const auto& input : inputs)
+		{
+			lua_createtable(state, 0, 3);
+
+			switch (input.type)
+			{
+				case input_type_t::keyDown:
+				case input_type_t::keyUp:
+				{
+					lua_pushstring(state, input.type == input_type_t::keyDown ? "key_down" : "key_up");
+					lua_setfield(state, -2, "type");
+
+					lua_pushinteger(state, input.keycode);
+					lua_setfield(state, -2, "keycode");
+					break;
+				}
+				case input_type_t::mouseMoved:
+				{
+					lua_pushstring(state, "mouse_moved");
+					lua_setfield(state, -2, "type");
+
+					lua_pushnumber(state, input.mouse.x);
+					lua_setfield(state, -2, "x");
+					lua_pushnumber(state, input.mouse.y);
+					lua_setfield(state, -2, "y");
+					break;
+				}
+			}
+
+			lua_rawseti(state, -2, index++);
+		}
+	}
+
 	int EventLuaScript::internalCall(const std::string& function, void* data)
 	{
 		initializeCall(function);
@@ -28,10 +69,13 @@ namespace Engine::Scripting
 		const auto* event = static_cast<EventHandling::Event*>(data);
 
 		// Event table
-		lua_createtable(state, 0, 4);
+		lua_createtable(state, 0, 5);
 		lua_pushnumber(state, event->delta_time);
 		lua_setfield(state, -2, "deltaTime");
 
+		lua_pushnumber(state, event->interpolation_alpha);
+		lua_setfield(state, -2, "alpha");
+
 		lua_pushinteger(state, event->keycode);
 		lua_setfield(state, -2, "keycode");
 
@@ -46,6 +90,19 @@ namespace Engine::Scripting
 		lua_setfield(state, -2, "y");
 		lua_setfield(state, -2, "mouse");
 
+		// Inputs array, only filled for onInput
+		if (event->event_type == EventHandling::EventType::onInput)
+		{
+			pushInputs(event->inputs);
+			lua_setfield(state, -2, "inputs");
+		}
+
+		if (event->event_type == EventHandling::EventType::onSceneLoaded)
+		{
+			lua_pushlstring(state, event->scene_name.data(), event->scene_name.size());
+			lua_setfield(state, -2, "scene");
+		}
+
 		// Call into script
 		// Stack content: [
 		//		...,
@@ -129,7 +129,7 @@ namespace Engine::Scripting
 			}
 			case Type::BOOL:
 			{
-				lua_toboolean(state, static_cast<int>(static_cast<bool>(*this)));
+				lua_pushboolean(state, static_cast<int>(static_cast<bool>(*this)));
 				break;
 			}
 			case Type::NUMBER:
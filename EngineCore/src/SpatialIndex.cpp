@@ -0,0 +1,412 @@
+#include "SpatialIndex.hpp"
+
+#include "Rendering/Bounds.hpp"
+
+#include "ObjectHandle.hpp"
+#include "glm/common.hpp"
+#include "glm/geometric.hpp"
+#include "glm/vec3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Engine
+{
+#pragma region Internal static
+
+	namespace
+	{
+		// Cell coordinates are packed into 21 bits per axis
+		constexpr int32_t cell_coord_bits  = 21;
+		constexpr int32_t cell_coord_limit = 1 << (cell_coord_bits - 1);
+
+		/**
+		 * Intersect a ray with a box (slab test)
+		 *
+		 * @param[out] distance Receives the distance of the entry point, 0 if the ray starts inside
+		 *
+		 * @return Whether the box is hit within @p max_distance
+		 */
+		[[nodiscard]] bool intersectRay(
+			const Rendering::AABB& box,
+			const glm::vec3&	   origin,
+			const glm::vec3&	   inverse_direction,
+			float				   max_distance,
+			float&				   distance
+		)
+		{
+			float t_min = 0.0f;
+			float t_max = max_distance;
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				// Infinite inverse for axis-parallel rays still gives the right comparison
+				float t_near = (box.min[axis] - origin[axis]) * inverse_direction[axis];
+				float t_far	 = (box.max[axis] - origin[axis]) * inverse_direction[axis];
+				if (t_near > t_far) { std::swap(t_near, t_far); }
+
+				// NaN happens when the origin lies exactly on a slab of a parallel ray
+				if (!std::isnan(t_near)) { t_min = std::max(t_min, t_near); }
+				if (!std::isnan(t_far)) { t_max = std::min(t_max, t_far); }
+
+				if (t_min > t_max) { return false; }
+			}
+
+			distance = t_min;
+			return true;
+		}
+	} // namespace
+
+#pragma endregion
+
+#pragma region Public
+
+	void SpatialIndex::update(ObjectHandle handle, Space space, const Rendering::AABB& bounds)
+	{
+		if (handle.index >= entries.size()) { entries.resize(handle.index + 1); }
+
+		const Grid&		grid	 = grids[static_cast<size_t>(space)];
+		const CellCoord cell_min = toCell(grid, bounds.min);
+		const CellCoord cell_max = toCell(grid, bounds.max);
+
+		Entry& entry = entries[handle.index];
+
+		// Most moves stay within the same cells, only the bounds have to change then
+		if (entry.present && entry.handle == handle && entry.space == space &&
+			entry.cell_min == cell_min && entry.cell_max == cell_max)
+		{
+			entry.bounds = bounds;
+			return;
+		}
+
+		if (entry.present) { unlink(handle.index); }
+
+		entry.handle   = handle;
+		entry.bounds   = bounds;
+		entry.cell_min = cell_min;
+		entry.cell_max = cell_max;
+		entry.space	   = space;
+
+		link(handle.index);
+	}
+
+	void SpatialIndex::remove(ObjectHandle handle)
+	{
+		if (handle.index >= entries.size()) { return; }
+
+		const Entry& entry = entries[handle.index];
+		if (!entry.present || entry.handle != handle) { return; }
+
+		unlink(handle.index);
+	}
+
+	void SpatialIndex::queryAABB(
+		Space					   space,
+		const Rendering::AABB&	   box,
+		std::vector<ObjectHandle>& out
+	) const
+	{
+		std::vector<uint32_t> found;
+		gatherOverlapping(space, box, found);
+
+		for (const uint32_t entry_index : found) { out.push_back(entries[entry_index].handle); }
+	}
+
+	void SpatialIndex::queryRadius(
+		Space					   space,
+		const glm::vec3&		   center,
+		float					   radius,
+		std::vector<ObjectHandle>& out
+	) const
+	{
+		std::vector<uint32_t> found;
+		gatherOverlapping(space, {.min = center - radius, .max = center + radius}, found);
+
+		for (const uint32_t entry_index : found)
+		{
+			const Rendering::AABB& bounds = entries[entry_index].bounds;
+
+			// Distance from the closest point of the box
+			const glm::vec3 offset = glm::clamp(center, bounds.min, bounds.max) - center;
+			if (glm::dot(offset, offset) <= radius * radius)
+			{
+				out.push_back(entries[entry_index].handle);
+			}
+		}
+	}
+
+	void SpatialIndex::queryRay(
+		Space					   space,
+		const glm::vec3&		   origin,
+		const glm::vec3&		   direction,
+		float					   max_distance,
+		std::vector<ObjectHandle>& out
+	) const
+	{
+		const Grid&		grid			  = grids[static_cast<size_t>(space)];
+		const glm::vec3 inverse_direction = 1.0f / direction;
+		const uint32_t	stamp			  = nextStamp();
+
+		std::vector<std::pair<float, uint32_t>> hits;
+
+		const auto test_entry = [&](uint32_t entry_index) {
+			const Entry& entry = entries[entry_index];
+			if (entry.query_stamp == stamp) { return; }
+			entry.query_stamp = stamp;
+
+			float distance;
+			if (intersectRay(entry.bounds, origin, inverse_direction, max_distance, distance))
+			{
+				hits.emplace_back(distance, entry_index);
+			}
+		};
+
+		for (const uint32_t entry_index : grid.oversized) { test_entry(entry_index); }
+
+		// Number of cells the ray crosses, walking them is only worth it for short rays
+		const glm::vec3 ray_cells = glm::abs(direction) * max_distance / grid.cell_size;
+		const float		cell_walk = ray_cells.x + ray_cells.y + ray_cells.z + 1.0f;
+
+		if (!std::isfinite(cell_walk) || cell_walk > static_cast<float>(entries.size()))
+		{
+			for (uint32_t entry_index = 0; entry_index < entries.size(); entry_index++)
+			{
+				const Entry& entry = entries[entry_index];
+				if (entry.present && entry.space == space) { test_entry(entry_index); }
+			}
+		}
+		else
+		{
+			// Walk the cells along the ray (Amanatides & Woo)
+			CellCoord cell = toCell(grid, origin);
+			CellCoord step;
+			glm::vec3 t_next;
+			glm::vec3 t_delta;
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				if (direction[axis] > 0.0f)
+				{
+					step[axis]	 = 1;
+					t_next[axis] =
+						(static_cast<float>(cell[axis] + 1) * grid.cell_size - origin[axis]) *
+						inverse_direction[axis];
+				}
+				else if (direction[axis] < 0.0f)
+				{
+					step[axis]	 = -1;
+					t_next[axis] = (static_cast<float>(cell[axis]) * grid.cell_size - origin[axis]) *
+								   inverse_direction[axis];
+				}
+				else
+				{
+					step[axis]	 = 0;
+					t_next[axis] = std::numeric_limits<float>::infinity();
+				}
+				t_delta[axis] = step[axis] != 0 ? grid.cell_size * std::abs(inverse_direction[axis])
+												: std::numeric_limits<float>::infinity();
+			}
+
+			while (true)
+			{
+				const auto found = grid.cells.find(packCell(cell[0], cell[1], cell[2]));
+				if (found != grid.cells.end())
+				{
+					for (const uint32_t entry_index : found->second) { test_entry(entry_index); }
+				}
+
+				int axis = 0;
+				if (t_next[1] < t_next[axis]) { axis = 1; }
+				if (t_next[2] < t_next[axis]) { axis = 2; }
+
+				if (t_next[axis] > max_distance) { break; }
+
+				cell[axis] += step[axis];
+				t_next[axis] += t_delta[axis];
+			}
+		}
+
+		std::sort(hits.begin(), hits.end());
+
+		for (const auto& [distance, entry_index] : hits)
+		{
+			out.push_back(entries[entry_index].handle);
+		}
+	}
+
+#pragma endregion
+
+#pragma region Private
+
+	uint64_t SpatialIndex::packCell(int32_t x, int32_t y, int32_t z) noexcept
+	{
+		constexpr uint64_t mask = (uint64_t{1} << cell_coord_bits) - 1;
+
+		const auto pack_axis = [](int32_t value) {
+			return static_cast<uint64_t>(value + cell_coord_limit) & mask;
+		};
+
+		return pack_axis(x) | (pack_axis(y) << cell_coord_bits) |
+			   (pack_axis(z) << (cell_coord_bits * 2));
+	}
+
+	SpatialIndex::CellCoord SpatialIndex::toCell(const Grid& grid, const glm::vec3& point) noexcept
+	{
+		CellCoord cell;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			const float scaled = std::floor(point[axis] / grid.cell_size);
+
+			// Far away (or non-finite) coordinates end up in the outermost cells
+			const float clamped = std::clamp(
+				scaled,
+				static_cast<float>(-cell_coord_limit),
+				static_cast<float>(cell_coord_limit - 1)
+			);
+			cell[axis] = std::isnan(clamped) ? 0 : static_cast<int32_t>(clamped);
+		}
+		return cell;
+	}
+
+	void SpatialIndex::link(uint32_t entry_index)
+	{
+		Entry& entry = entries[entry_index];
+		Grid&  grid	 = grids[static_cast<size_t>(entry.space)];
+
+		size_t cell_count = 1;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			cell_count *= static_cast<size_t>(entry.cell_max[axis] - entry.cell_min[axis]) + 1;
+		}
+
+		entry.present	= true;
+		entry.oversized = cell_count > max_cells_per_object;
+
+		if (entry.oversized)
+		{
+			grid.oversized.push_back(entry_index);
+			return;
+		}
+
+		for (int32_t x = entry.cell_min[0]; x <= entry.cell_max[0]; x++)
+		{
+			for (int32_t y = entry.cell_min[1]; y <= entry.cell_max[1]; y++)
+			{
+				for (int32_t z = entry.cell_min[2]; z <= entry.cell_max[2]; z++)
+				{
+					grid.cells[packCell(x, y, z)].push_back(entry_index);
+				}
+			}
+		}
+	}
+
+	void SpatialIndex::unlink(uint32_t entry_index)
+	{
+		Entry& entry = entries[entry_index];
+		Grid&  grid	 = grids[static_cast<size_t>(entry.space)];
+
+		const auto erase_from = [entry_index](std::vector<uint32_t>& list) {
+			auto found = std::find(list.begin(), list.end(), entry_index);
+			if (found == list.end()) { return; }
+
+			*found = list.back();
+			list.pop_back();
+		};
+
+		entry.present = false;
+
+		if (entry.oversized)
+		{
+			erase_from(grid.oversized);
+			return;
+		}
+
+		for (int32_t x = entry.cell_min[0]; x <= entry.cell_max[0]; x++)
+		{
+			for (int32_t y = entry.cell_min[1]; y <= entry.cell_max[1]; y++)
+			{
+				for (int32_t z = entry.cell_min[2]; z <= entry.cell_max[2]; z++)
+				{
+					auto cell = grid.cells.find(packCell(x, y, z));
+					if (cell == grid.cells.end()) { continue; }
+
+					erase_from(cell->second);
+					if (cell->second.empty()) { grid.cells.erase(cell); }
+				}
+			}
+		}
+	}
+
+	uint32_t SpatialIndex::nextStamp() const
+	{
+		current_stamp++;
+
+		// Entries may hold any older stamp, reset them all when wrapping around
+		if (current_stamp == 0)
+		{
+			for (const auto& entry : entries) { entry.query_stamp = 0; }
+			current_stamp = 1;
+		}
+
+		return current_stamp;
+	}
+
+	void SpatialIndex::gatherOverlapping(
+		Space				   space,
+		const Rendering::AABB& box,
+		std::vector<uint32_t>& out
+	) const
+	{
+		const Grid&		grid	 = grids[static_cast<size_t>(space)];
+		const uint32_t	stamp	 = nextStamp();
+		const CellCoord cell_min = toCell(grid, box.min);
+		const CellCoord cell_max = toCell(grid, box.max);
+
+		const auto test_entry = [&](uint32_t entry_index) {
+			const Entry& entry = entries[entry_index];
+			if (entry.query_stamp == stamp) { return; }
+			entry.query_stamp = stamp;
+
+			if (entry.bounds.overlaps(box)) { out.push_back(entry_index); }
+		};
+
+		for (const uint32_t entry_index : grid.oversized) { test_entry(entry_index); }
+
+		size_t cell_count = 1;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			cell_count *= static_cast<size_t>(cell_max[axis] - cell_min[axis]) + 1;
+		}
+
+		// Large query boxes would visit mostly empty cells, test the occupied ones instead
+		if (cell_count > grid.cells.size())
+		{
+			for (const auto& [key, cell] : grid.cells)
+			{
+				for (const uint32_t entry_index : cell) { test_entry(entry_index); }
+			}
+			return;
+		}
+
+		for (int32_t x = cell_min[0]; x <= cell_max[0]; x++)
+		{
+			for (int32_t y = cell_min[1]; y <= cell_max[1]; y++)
+			{
+				for (int32_t z = cell_min[2]; z <= cell_max[2]; z++)
+				{
+					const auto found = grid.cells.find(packCell(x, y, z));
+					if (found == grid.cells.end()) { continue; }
+
+					for (const uint32_t entry_index : found->second) { test_entry(entry_index); }
+				}
+			}
+		}
+	}
+
+#pragma endregion
+} // namespace Engine
@@ -0,0 +1,117 @@
+#include "MemoryUsage.hpp"
+#include "SceneBudget.hpp"
+
+#include <cstdio>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using Engine::MemoryUsage;
+	using Engine::SceneBudgetEntry;
+
+	class TestFailure final : public std::runtime_error
+	{
+	public:
+		using std::runtime_error::runtime_error;
+	};
+
+#define TEST_ASSERT(condition)                                                                     \
+	if (!(condition))                                                                              \
+	{                                                                                              \
+		throw TestFailure(std::string(#condition) + " (line " + std::to_string(__LINE__) + ")");    \
+	}
+
+	std::vector<std::string> names(const std::vector<SceneBudgetEntry>& entries)
+	{
+		std::vector<std::string> result;
+		for (const auto& entry : entries) { result.push_back(entry.name); }
+
+		return result;
+	}
+
+	void testWithinBudget()
+	{
+		const std::vector<SceneBudgetEntry> scenes = {
+			{.name = "a", .usage = {.cpu_bytes = 100}, .last_used = 1, .is_unloadable = true},
+			{.name = "b", .usage = {.cpu_bytes = 100}, .last_used = 2, .is_unloadable = true},
+		};
+
+		TEST_ASSERT(Engine::selectScenesToUnload(scenes, {.cpu_bytes = 200}).empty());
+
+		// Unlimited budget
+		TEST_ASSERT(Engine::selectScenesToUnload(scenes, {}).empty());
+	}
+
+	void testLeastRecentlyUsedFirst()
+	{
+		const std::vector<SceneBudgetEntry> scenes = {
+			{.name = "newest", .usage = {.gpu_bytes = 100}, .last_used = 3, .is_unloadable = true},
+			{.name = "oldest", .usage = {.gpu_bytes = 100}, .last_used = 1, .is_unloadable = true},
+			{.name = "older", .usage = {.gpu_bytes = 100}, .last_used = 2, .is_unloadable = true},
+		};
+
+		const auto unload = Engine::selectScenesToUnload(scenes, {.gpu_bytes = 150});
+
+		TEST_ASSERT(names(unload) == std::vector<std::string>({"oldest", "older"}));
+	}
+
+	void testBudgetSmallerThanScene()
+	{
+		const MemoryUsage budget = {.cpu_bytes = 1, .gpu_bytes = 1};
+
+		// Startup, the placeholder scene is current and the default scene was just loaded
+		const std::vector<SceneBudgetEntry> loading = {
+			{.name = "_default", .usage = {.cpu_bytes = 10}, .last_used = 1},
+			{.name = "default", .usage = {.cpu_bytes = 500, .gpu_bytes = 500}, .last_used = 2},
+		};
+		TEST_ASSERT(Engine::selectScenesToUnload(loading, budget).empty());
+
+		// Once switched, only the previous scene goes, the current one stays over budget
+		const std::vector<SceneBudgetEntry> switched = {
+			{.name = "_default", .usage = {.cpu_bytes = 10}, .last_used = 1, .is_unloadable = true},
+			{.name = "default", .usage = {.cpu_bytes = 500, .gpu_bytes = 500}, .last_used = 3},
+			{.name = "preloaded", .usage = {.cpu_bytes = 500}, .last_used = 2},
+		};
+		const auto unload = Engine::selectScenesToUnload(switched, budget);
+
+		TEST_ASSERT(names(unload) == std::vector<std::string>({"_default"}));
+	}
+
+	struct TestCase
+	{
+		const char*			  name;
+		std::function<void()> function;
+	};
+} // namespace
+
+int main()
+{
+	const std::vector<TestCase> tests = {
+		{"withinBudget", testWithinBudget},
+		{"leastRecentlyUsedFirst", testLeastRecentlyUsedFirst},
+		{"budgetSmallerThanScene", testBudgetSmallerThanScene},
+	};
+
+	int failed = 0;
+	for (const auto& test : tests)
+	{
+		try
+		{
+			test.function();
+			std::printf("[ OK ] %s\n", test.name);
+		}
+		catch (const std::exception& e)
+		{
+			std::printf("[FAIL] %s: %s\n", test.name, e.what());
+			failed++;
+		}
+	}
+
+	std::printf("%zu tests, %d failed\n", tests.size(), failed);
+
+	return failed == 0 ? 0 : 1;
+}
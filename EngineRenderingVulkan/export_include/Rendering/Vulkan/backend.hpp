@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../../../include/backend/DeletionQueue.hpp"	// IWYU pragma: export
 #include "../../../include/backend/DeviceScore.hpp"		// IWYU pragma: export
 #include "../../../include/backend/Instance.hpp"		// IWYU pragma: export
 #include "../../../include/backend/LogicalDevice.hpp"	// IWYU pragma: export
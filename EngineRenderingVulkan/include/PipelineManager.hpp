@@ -10,7 +10,9 @@
 #include "common/StructDefs.hpp"
 #include "rendering/Pipeline.hpp"
 #include "rendering/PipelineSettings.hpp"
+#include "vulkan/vulkan_raii.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <memory>
@@ -35,12 +37,44 @@ namespace Engine::Rendering::Vulkan
 
 		PipelineUserRef* getPipeline(const PipelineSettings& with_settings);
 
+		/**
+		 * Upload the uniforms shared by all pipelines and bind them as descriptor set 0
+		 *
+		 * Call once at the start of recording a frame, before any pipeline is bound.
+		 */
+		void bindFrameData(
+			vk::CommandBuffer		with_command_buffer,
+			uint32_t				current_frame,
+			const FrameUniformData& with_data
+		);
+
+		/**
+		 * Get the number of pipelines created since construction
+		 */
+		[[nodiscard]] size_t getCreatedCount() const
+		{
+			return created_count;
+		}
+
 	private:
 		std::filesystem::path			shader_path;
 		std::unique_ptr<ShaderCompiler> compiler;
 
 		std::vector<std::tuple<PipelineSettings, std::weak_ptr<Pipeline>>> pipelines;
 
+		// Also counts pipelines that were deallocated since
+		size_t created_count = 0;
+
+		// Set 0 of every pipeline layout, holds FrameUniformData
+		vk::raii::DescriptorSetLayout frame_set_layout		= nullptr;
+		vk::raii::PipelineLayout	  frame_pipeline_layout = nullptr;
+		vk::raii::DescriptorPool	  frame_descriptor_pool = nullptr;
+		vk::raii::DescriptorSets	  frame_descriptor_sets = nullptr;
+
+		per_frame_array<std::unique_ptr<UniformBuffer>> frame_uniform_buffers;
+
+		void createFrameResources();
+
 		std::pair<std::shared_ptr<Pipeline>, std::string_view> findPipeline(
 			const PipelineSettings& with_settings
 		);
@@ -72,9 +106,31 @@ namespace Engine::Rendering::Vulkan
 			return user_data->getUniformBuffer(current_frame);
 		}
 
+		/**
+		 * Get the pipeline this reference shares, equal for all references to it
+		 */
+		[[nodiscard]] const Pipeline* getOrigin() const noexcept
+		{
+			return origin.get();
+		}
+
 		void bindPipeline(vk::CommandBuffer with_command_buffer, uint32_t current_frame)
 		{
-			origin->bindPipeline(*user_data, with_command_buffer, current_frame);
+			bindDescriptorSets(with_command_buffer, current_frame);
+			origin->bindPipeline(with_command_buffer);
+		}
+
+		/**
+		 * Bind only this user's descriptor set, for when the pipeline is already bound
+		 */
+		void bindDescriptorSets(vk::CommandBuffer with_command_buffer, uint32_t current_frame)
+		{
+			origin->bindDescriptorSets(*user_data, with_command_buffer, current_frame);
+		}
+
+		void bindOrigin(vk::CommandBuffer with_command_buffer)
+		{
+			origin->bindPipeline(with_command_buffer);
 		}
 
 		void updateDescriptorSets(per_frame_array<vk::WriteDescriptorSet> with_writes);
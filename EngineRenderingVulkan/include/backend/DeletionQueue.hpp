@@ -0,0 +1,109 @@
+#pragma once
+// IWYU pragma: private; include Rendering/Vulkan/backend.hpp
+
+#include "fwd.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace Engine::Rendering::Vulkan
+{
+	/**
+	 * Defers destruction of objects until no frame in flight can reference them
+	 *
+	 * Every retired object is tagged with the frames that were recorded or submitted so far
+	 * and destroyed by @ref collect() once all of them have signalled their in-flight fence.
+	 * Retiring never waits on the GPU.
+	 *
+	 * @note Objects are destroyed on the thread calling @ref collect()
+	 */
+	class DeletionQueue final
+	{
+	public:
+		DeletionQueue() = default;
+		~DeletionQueue();
+
+		DeletionQueue(const DeletionQueue&)			   = delete;
+		DeletionQueue& operator=(const DeletionQueue&) = delete;
+
+		/**
+		 * Take ownership of an object and delete it once the GPU is done with it
+		 */
+		template <typename value_t> void retire(value_t* object)
+		{
+			if (object == nullptr) { return; }
+
+			retireErased(object, [](void* ptr) { delete static_cast<value_t*>(ptr); });
+		}
+
+		/** @copydoc retire(value_t*) */
+		template <typename value_t> void retire(std::unique_ptr<value_t> object)
+		{
+			retire(object.release());
+		}
+
+		/**
+		 * Release a reference once the GPU is done with it, the object is only destroyed
+		 * if no other reference is left at that point
+		 */
+		template <typename value_t> void retire(std::shared_ptr<value_t> object)
+		{
+			if (object == nullptr) { return; }
+
+			retire(new std::shared_ptr<value_t>(std::move(object)));
+		}
+
+		/**
+		 * Call after the in-flight fence of a frame has been waited on, before recording it
+		 */
+		void beginFrame() noexcept;
+
+		/**
+		 * Call after a frame has been submitted
+		 */
+		void endFrame() noexcept;
+
+		/**
+		 * Destroy all objects whose frames have finished
+		 *
+		 * @return Number of destroyed objects
+		 */
+		size_t collect();
+
+		/**
+		 * Destroy all objects regardless of frames
+		 *
+		 * @note Only valid once the device is idle
+		 */
+		void flush();
+
+		[[nodiscard]] size_t getPendingCount() const;
+
+	private:
+		struct Entry
+		{
+			// Object may be destroyed once this many frames have completed
+			uint64_t release_after;
+			void*	 object;
+			void (*deleter)(void*);
+		};
+
+		mutable std::mutex lock;
+		std::deque<Entry>  entries;
+
+		std::atomic<uint64_t> submitted_frames = 0;
+		std::atomic<uint64_t> completed_frames = 0;
+
+		void retireErased(void* object, void (*deleter)(void*));
+
+		/**
+		 * Destroy entries while not holding the lock, since destructors may retire more objects
+		 */
+		static void destroyAll(std::deque<Entry>& ready);
+	};
+} // namespace Engine::Rendering::Vulkan
@@ -38,10 +38,23 @@ namespace Engine::Rendering::Vulkan
 		int	 preference_score = 0;	   // Higher better
 		bool supported		  = false; // Must be true
 
-		DeviceScore(const PhysicalDevice& with_device, const Surface& with_surface);
+		/**
+		 * @param with_surface Surface the device has to present to,
+		 *                     nullptr when scoring for headless rendering
+		 */
+		DeviceScore(const PhysicalDevice& with_device, const Surface* with_surface);
 
 		static const std::vector<const char*> device_extensions;
-		static bool checkDeviceExtensionSupport(const vk::raii::PhysicalDevice& device);
+		static const std::vector<const char*> presentation_extensions;
+
+		/**
+		 * Get all device extensions that have to be enabled
+		 *
+		 * @param with_presentation Whether presentation extensions are included
+		 */
+		[[nodiscard]] static std::vector<const char*> getRequiredExtensions(bool with_presentation);
+		[[nodiscard]] static bool
+		checkDeviceExtensionSupport(const vk::raii::PhysicalDevice& device, bool with_presentation);
 
 		operator bool() const
 		{
@@ -7,6 +7,7 @@
 
 #include "Logging/Logging.hpp"
 
+#include "backend/DeletionQueue.hpp"
 #include "backend/LogicalDevice.hpp"
 #include "backend/MemoryAllocator.hpp"
 #include "backend/PhysicalDevice.hpp"
@@ -35,11 +36,22 @@ namespace Engine::Rendering::Vulkan
 			const ScreenSize						size;
 			const std::string&						title;
 			const std::vector<std::pair<int, int>>& hints;
+
+			/**
+			 * Skip GLFW entirely and render into offscreen images,
+			 * allows running on machines without a display (e.g. lavapipe)
+			 */
+			const bool headless = false;
 		};
 
 		Instance(SupportsLogging::logger_t with_logger, const WindowParams&& with_window_parameters);
 		~Instance();
 
+		[[nodiscard]] bool isHeadless() const
+		{
+			return headless;
+		}
+
 		[[nodiscard]] Window* getWindow()
 		{
 			return window;
@@ -65,17 +77,28 @@ namespace Engine::Rendering::Vulkan
 			return memory_allocator;
 		}
 
+		/**
+		 * Get the queue that objects still referenced by frames in flight are retired to
+		 */
+		[[nodiscard]] DeletionQueue* getDeletionQueue()
+		{
+			return deletion_queue;
+		}
+
 	private:
 		vk::raii::DebugUtilsMessengerEXT debug_messenger = nullptr;
 
 		vk::raii::Context context;
 
+		const bool headless;
+
 		PhysicalDevice*	 physical_device  = nullptr;
 		LogicalDevice*	 logical_device	  = nullptr;
 		MemoryAllocator* memory_allocator = nullptr;
 
-		Window*		 window		  = nullptr;
-		CommandPool* command_pool = nullptr;
+		Window*		   window		  = nullptr;
+		CommandPool*   command_pool	  = nullptr;
+		DeletionQueue* deletion_queue = nullptr;
 
 		void initInstance();
 		void initDevice();
@@ -12,7 +12,7 @@ namespace Engine::Rendering::Vulkan
 	class LogicalDevice : public InstanceOwned, public vk::raii::Device
 	{
 	public:
-		LogicalDevice(InstanceOwned::value_t with_instance, const Surface& with_surface);
+		LogicalDevice(InstanceOwned::value_t with_instance, const Surface* with_surface);
 
 		[[nodiscard]] const QueueFamilyIndices& getQueueFamilies() const
 		{
@@ -34,6 +34,6 @@ namespace Engine::Rendering::Vulkan
 		vk::raii::Queue	   graphics_queue = nullptr;
 		vk::raii::Queue	   present_queue  = nullptr;
 
-		vk::raii::Device createDevice(Instance* with_instance, const Surface& with_surface);
+		vk::raii::Device createDevice(Instance* with_instance, const Surface* with_surface);
 	};
 } // namespace Engine::Rendering::Vulkan
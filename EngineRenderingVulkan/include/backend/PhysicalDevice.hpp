@@ -32,8 +32,14 @@ namespace Engine::Rendering::Vulkan
 
 		[[nodiscard]] vk::Format findSupportedDepthFormat() const;
 
+		/**
+		 * Find queue families for graphics and presentation
+		 *
+		 * @param with_surface Surface to check present support against,
+		 *                     if nullptr the graphics family is used for both
+		 */
 		[[nodiscard]] std::optional<QueueFamilyIndices> findVulkanQueueFamilies(
-			const Surface& with_surface
+			const Surface* with_surface
 		) const;
 	};
 
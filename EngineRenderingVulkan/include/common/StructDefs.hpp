@@ -18,10 +18,26 @@ namespace Engine::Rendering
 	template <typename value_type>
 	using per_frame_array = std::array<value_type, max_frames_in_flight>;
 
+	/**
+	 * Uniforms shared by everything drawn in a frame, bound once per frame as descriptor set 0
+	 */
+	struct FrameUniformData
+	{
+		glm::mat4 mat_vp{};		  // Camera view and perspective projection
+		glm::mat4 mat_vp_ortho{}; // Screen-space projection
+	};
+
+	// Selects which view-projection of FrameUniformData an object is drawn with
+	enum class ProjectionType : uint32_t
+	{
+		perspective = 0,
+		ortho		= 1,
+	};
+
 	struct RendererMatrixData
 	{
-		glm::mat4 mat_vp{};
-		glm::mat4 mat_model{};
+		glm::mat4	   mat_model{};
+		ProjectionType projection = ProjectionType::perspective;
 	};
 
 	struct QueueFamilyIndices
@@ -12,6 +12,7 @@ namespace Engine::Rendering::Vulkan
 	class Instance;
 	class PhysicalDevice;
 	class LogicalDevice;
+	class DeletionQueue;
 
 	struct DeviceScore;
 	struct MemoryAllocator;
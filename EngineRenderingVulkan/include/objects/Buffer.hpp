@@ -10,6 +10,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <memory>
 #include <vector>
 
 namespace Engine::Rendering::Vulkan
@@ -38,6 +39,11 @@ namespace Engine::Rendering::Vulkan
 			vk::BufferUsageFlags	with_usage,
 			vk::MemoryPropertyFlags with_properties
 		);
+
+		/**
+		 * @note Does not wait for the device, buffers that frames in flight may still use
+		 *       have to be retired to the @ref DeletionQueue instead of deleted
+		 */
 		~Buffer();
 
 		void mapMemory();
@@ -123,6 +129,25 @@ namespace Engine::Rendering::Vulkan
 			CommandBuffer&						with_commandbuffer,
 			const std::vector<RenderingVertex>& vertices
 		);
+
+		/**
+		 * Construct in-place with data, recording the copy without submitting it
+		 *
+		 * Used to batch uploads of many buffers into a single submission.
+		 *
+		 * @param with_device,with_allocator See Buffer for common parameters
+		 * @param with_commandbuffer A command buffer in the recording state,
+		 *                           data is only copied once it's submitted and has finished
+		 * @param vertices A container of vertices to copy into this buffer
+		 * @param out_staging Receives the staging buffer, has to be kept alive until the copy finished
+		 */
+		VertexBuffer(
+			LogicalDevice*						with_device,
+			MemoryAllocator*					with_allocator,
+			CommandBuffer&						with_commandbuffer,
+			const std::vector<RenderingVertex>& vertices,
+			std::unique_ptr<StagingBuffer>&		out_staging
+		);
 	};
 
 	/**
@@ -32,6 +32,22 @@ namespace Engine::Rendering::Vulkan
 		 */
 		void queueSubmit(vk::raii::Queue& to_queue);
 
+		/**
+		 * Submit this command buffer to a queue without waiting for it to finish
+		 *
+		 * @note The command buffer (and anything it references) has to be retired
+		 *       to the @ref DeletionQueue instead of destroyed
+		 *
+		 * @param to_queue The queue to submit to
+		 */
+		void queueSubmitAsync(vk::raii::Queue& to_queue);
+
+		/**
+		 * Make transfer writes recorded so far visible to vertex input,
+		 * including that of later submissions to the same queue
+		 */
+		void barrierTransferToVertexInput();
+
 		/**
 		 * Shortcut to calling begin with eOneTimeSubmit
 		 */
@@ -48,14 +48,29 @@ namespace Engine::Rendering::Vulkan
 			InstanceOwned::value_t		 with_instance,
 			const ShaderCompiler&		 with_shader_compiler,
 			RenderPass*					 with_render_pass,
+			vk::DescriptorSetLayout		 with_frame_set_layout,
 			PipelineSettings			 settings,
-			const std::filesystem::path& shader_path
+			const std::filesystem::path& shader_path,
+			uint32_t					 with_id
 		);
 		~Pipeline() = default;
 
 		[[nodiscard]] UserData* allocateNewUserData();
 
-		void bindPipeline(
+		/**
+		 * Get the creation order of this pipeline, stable for as long as it lives
+		 */
+		[[nodiscard]] uint32_t getId() const noexcept
+		{
+			return id;
+		}
+
+		void bindPipeline(vk::CommandBuffer with_command_buffer);
+
+		/**
+		 * Bind the descriptor set of a user as set 1
+		 */
+		void bindDescriptorSets(
 			UserData&		  userdata_ref,
 			vk::CommandBuffer with_command_buffer,
 			uint32_t		  current_frame
@@ -74,6 +89,8 @@ namespace Engine::Rendering::Vulkan
 
 		std::vector<vk::DescriptorPoolSize> pool_sizes;
 
+		uint32_t id;
+
 		void allocateNewDescriptorPool(UserData& data_ref);
 		void allocateNewDescriptorSets(UserData& data_ref);
 	};
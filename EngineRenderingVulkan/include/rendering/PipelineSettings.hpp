@@ -45,6 +45,9 @@ namespace Engine::Rendering::Vulkan
 		// maps binding->setting
 		std::map<uint32_t, DescriptorBindingSetting> descriptor_settings;
 
+		// Blended draws ordered back-to-front must not hide what is drawn after them
+		bool depth_write = true;
+
 		PipelineSettings() = default;
 		PipelineSettings(
 			const vk::Extent2D			with_extent,
@@ -98,7 +101,7 @@ namespace Engine::Rendering::Vulkan
 			}
 
 			return topo_match && extent_match && shader_match && scissor_match &&
-				   settings_match;
+				   (depth_write == other.depth_write) && settings_match;
 		}
 
 		static vk::PipelineInputAssemblyStateCreateInfo getInputAssemblySettings(
@@ -193,11 +196,11 @@ namespace Engine::Rendering::Vulkan
 			return &color_blending;
 		}
 
-		static const vk::PipelineDepthStencilStateCreateInfo* getDepthStencilSettings()
+		static vk::PipelineDepthStencilStateCreateInfo getDepthStencilSettings(bool depth_write)
 		{
-			static vk::PipelineDepthStencilStateCreateInfo depth_stencil{
+			vk::PipelineDepthStencilStateCreateInfo depth_stencil{
 				.depthTestEnable	   = vk::True,
-				.depthWriteEnable	   = vk::True,
+				.depthWriteEnable	   = static_cast<vk::Bool32>(depth_write),
 				.depthCompareOp		   = vk::CompareOp::eLess,
 				.depthBoundsTestEnable = vk::False,
 				.stencilTestEnable	   = vk::False,
@@ -207,7 +210,7 @@ namespace Engine::Rendering::Vulkan
 				.maxDepthBounds		   = 1.f
 			};
 
-			return &depth_stencil;
+			return depth_stencil;
 		}
 	};
 } // namespace Engine::Rendering::Vulkan
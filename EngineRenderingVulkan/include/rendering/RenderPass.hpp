@@ -14,7 +14,8 @@ namespace Engine::Rendering::Vulkan
 		RenderPass(
 			const PhysicalDevice* with_physical_device,
 			LogicalDevice*		  with_logical_device,
-			vk::Format			  with_format
+			vk::Format			  with_format,
+			vk::ImageLayout		  with_final_layout = vk::ImageLayout::ePresentSrcKHR
 		);
 		~RenderPass() = default;
 	};
@@ -55,10 +55,19 @@ namespace Engine::Rendering::Vulkan
 	static_assert(!std::is_copy_constructible_v<RenderTarget> && !std::is_copy_assignable_v<RenderTarget>);
 	static_assert(std::is_move_constructible_v<RenderTarget> && std::is_move_assignable_v<RenderTarget>);
 
+	/**
+	 * Set of render targets for a window.
+	 *
+	 * When constructed without a surface (headless), no swapchain handle is created
+	 * and rendering resolves into offscreen images instead.
+	 */
 	class Swapchain final : public InstanceOwned,
 							public HandleWrapper<vk::raii::SwapchainKHR>
 	{
 	public:
+		/**
+		 * @param with_surface Surface to present to, nullptr to render offscreen
+		 */
 		Swapchain(
 			InstanceOwned::value_t with_instance,
 			Surface*			   with_surface,
@@ -104,6 +113,9 @@ namespace Engine::Rendering::Vulkan
 		std::vector<vk::Image>			 image_handles;
 		std::vector<vk::raii::ImageView> image_view_handles;
 
+		// Resolve targets used in place of swapchain images when headless
+		std::vector<ViewedImage*> offscreen_images;
+
 		ViewedImage* depth_image = nullptr;
 		ViewedImage* color_image = nullptr;
 
@@ -113,5 +125,8 @@ namespace Engine::Rendering::Vulkan
 		const vk::Extent2D	 extent;
 
 		RenderPass* render_pass = nullptr;
+
+		void createPresentImages(Surface* with_surface, uint32_t with_count);
+		void createOffscreenImages(uint32_t with_count);
 	};
 } // namespace Engine::Rendering::Vulkan
@@ -106,9 +106,14 @@ namespace Engine::Rendering::Vulkan
 			return swapchain;
 		}
 
-		[[nodiscard]] const Surface& getSurface() const
+		/**
+		 * Get the surface associated with this window
+		 *
+		 * @return Pointer to the surface or nullptr if the owning instance is headless
+		 */
+		[[nodiscard]] const Surface* getSurface() const
 		{
-			return surface;
+			return native_handle != nullptr ? &surface : nullptr;
 		}
 
 		void createSwapchain();
@@ -127,6 +132,9 @@ namespace Engine::Rendering::Vulkan
 		ScreenSize size;
 		uint32_t   current_frame = 0;
 
+		// Used instead of the GLFW attribute when headless
+		bool headless_should_close = false;
+
 		Swapchain* swapchain = nullptr;
 		Surface	   surface;
 
@@ -0,0 +1,101 @@
+#include "backend/DeletionQueue.hpp"
+
+#include "common/StructDefs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace Engine::Rendering::Vulkan
+{
+#pragma region Public
+
+	DeletionQueue::~DeletionQueue()
+	{
+		flush();
+	}
+
+	void DeletionQueue::beginFrame() noexcept
+	{
+		// This frame reuses the in-flight slot of the frame max_frames_in_flight before it,
+		// once that fence signalled all earlier frames have completed too
+		const uint64_t frame = submitted_frames.load();
+		if (frame + 1 >= max_frames_in_flight)
+		{
+			completed_frames.store(frame + 1 - max_frames_in_flight);
+		}
+	}
+
+	void DeletionQueue::endFrame() noexcept
+	{
+		submitted_frames.fetch_add(1);
+	}
+
+	size_t DeletionQueue::collect()
+	{
+		std::deque<Entry> ready;
+		{
+			std::lock_guard guard(lock);
+
+			const uint64_t completed = completed_frames.load();
+
+			// Entries are retired in order, so they become ready in order
+			while (!entries.empty() && entries.front().release_after <= completed)
+			{
+				ready.push_back(entries.front());
+				entries.pop_front();
+			}
+		}
+
+		const size_t count = ready.size();
+		destroyAll(ready);
+
+		return count;
+	}
+
+	void DeletionQueue::flush()
+	{
+		// Destructors may retire more objects, repeat until nothing is left
+		while (true)
+		{
+			std::deque<Entry> ready;
+			{
+				std::lock_guard guard(lock);
+				if (entries.empty()) { return; }
+
+				ready.swap(entries);
+			}
+
+			destroyAll(ready);
+		}
+	}
+
+	size_t DeletionQueue::getPendingCount() const
+	{
+		std::lock_guard guard(lock);
+		return entries.size();
+	}
+
+#pragma endregion
+
+#pragma region Private
+
+	void DeletionQueue::retireErased(void* object, void (*deleter)(void*))
+	{
+		std::lock_guard guard(lock);
+
+		// The frame being recorded right now (if any) has not been submitted yet
+		entries.push_back(
+			{.release_after = submitted_frames.load() + 1, .object = object, .deleter = deleter}
+		);
+	}
+
+	void DeletionQueue::destroyAll(std::deque<Entry>& ready)
+	{
+		for (const auto& entry : ready) { entry.deleter(entry.object); }
+		ready.clear();
+	}
+
+#pragma endregion
+} // namespace Engine::Rendering::Vulkan
@@ -9,11 +9,14 @@
 namespace Engine::Rendering::Vulkan
 {
 	const std::vector<const char*> DeviceScore::device_extensions = {
-		vk::KHRSwapchainExtensionName,
 		vk::EXTRobustness2ExtensionName,
 	};
 
-	DeviceScore::DeviceScore(const PhysicalDevice& with_device, const Surface& with_surface)
+	const std::vector<const char*> DeviceScore::presentation_extensions = {
+		vk::KHRSwapchainExtensionName,
+	};
+
+	DeviceScore::DeviceScore(const PhysicalDevice& with_device, const Surface* with_surface)
 		: device_scored(with_device)
 	{
 		vk::PhysicalDeviceProperties device_properties = with_device.getProperties();
@@ -43,7 +46,7 @@ namespace Engine::Rendering::Vulkan
 			return;
 		}
 
-		if (!checkDeviceExtensionSupport(with_device))
+		if (!checkDeviceExtensionSupport(with_device, with_surface != nullptr))
 		{
 			unsupported_reason = "required extensions unsupported";
 			return;
@@ -55,27 +58,52 @@ namespace Engine::Rendering::Vulkan
 			return;
 		}
 
-		SwapChainSupportDetails swap_chain_support = with_surface.querySwapChainSupport(with_device);
+		// Swap chain support only matters when we present to a surface
+		if (with_surface != nullptr)
+		{
+			SwapChainSupportDetails swap_chain_support =
+				with_surface->querySwapChainSupport(with_device);
 
-		bool swap_chain_adequate = !swap_chain_support.formats.empty() &&
-								   !swap_chain_support.present_modes.empty();
+			bool swap_chain_adequate = !swap_chain_support.formats.empty() &&
+									   !swap_chain_support.present_modes.empty();
 
-		if (!swap_chain_adequate)
-		{
-			unsupported_reason = "inadequate or no swap chain support";
-			return;
+			if (!swap_chain_adequate)
+			{
+				unsupported_reason = "inadequate or no swap chain support";
+				return;
+			}
 		}
 
 		// Device supported, check suitability
 		supported = true;
 	}
 
-	bool DeviceScore::checkDeviceExtensionSupport(const vk::raii::PhysicalDevice& device)
+	std::vector<const char*> DeviceScore::getRequiredExtensions(bool with_presentation)
+	{
+		std::vector<const char*> extensions = device_extensions;
+
+		if (with_presentation)
+		{
+			extensions.insert(
+				extensions.end(),
+				presentation_extensions.begin(),
+				presentation_extensions.end()
+			);
+		}
+
+		return extensions;
+	}
+
+	bool DeviceScore::checkDeviceExtensionSupport(
+		const vk::raii::PhysicalDevice& device,
+		bool							with_presentation
+	)
 	{
 		std::vector<vk::ExtensionProperties> available_extensions =
 			device.enumerateDeviceExtensionProperties();
 
-		std::set<std::string> required_extensions(device_extensions.begin(), device_extensions.end());
+		const auto			  extensions = getRequiredExtensions(with_presentation);
+		std::set<std::string> required_extensions(extensions.begin(), extensions.end());
 
 		for (const auto& extension : available_extensions)
 		{
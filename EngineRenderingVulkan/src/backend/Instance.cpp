@@ -6,6 +6,7 @@
 #define ENGINERENDERINGVULKAN_LIBRARY_IMPLEMENTATION
 #include "Logging/Logging.hpp"
 
+#include "backend/DeletionQueue.hpp"
 #include "backend/DeviceScore.hpp"
 #include "backend/Instance.hpp"
 #include "backend/LogicalDevice.hpp"
@@ -49,15 +50,26 @@ namespace Engine::Rendering::Vulkan
 		SupportsLogging::logger_t with_logger,
 		const WindowParams&&	  with_window_parameters
 	)
-		: SupportsLogging(std::move(with_logger))
+		: SupportsLogging(std::move(with_logger)), headless(with_window_parameters.headless)
 	{
-		if (glfwInit() == GLFW_FALSE)
+		// Headless instances never touch GLFW, there may be no display to connect to
+		if (!headless)
 		{
-			throw ENGINE_EXCEPTION("GLFW returned GLFW_FALSE on glfwInit!");
-		}
-		glfwSetErrorCallback(glfwErrorCallback);
+			if (glfwInit() == GLFW_FALSE)
+			{
+				throw ENGINE_EXCEPTION("GLFW returned GLFW_FALSE on glfwInit!");
+			}
+			glfwSetErrorCallback(glfwErrorCallback);
 
-		this->logger->logSingle<decltype(this)>(Logging::LogLevel::Info, "GLFW initialized");
+			this->logger->logSingle<decltype(this)>(Logging::LogLevel::Info, "GLFW initialized");
+		}
+		else
+		{
+			this->logger->logSingle<decltype(this)>(
+				Logging::LogLevel::Info,
+				"Running headless, GLFW will not be initialized"
+			);
+		}
 
 		// Initialize dynamic dispatcher base before all other vulkan calls
 		VULKAN_HPP_DEFAULT_DISPATCHER.init(vkGetInstanceProcAddr);
@@ -80,6 +92,8 @@ namespace Engine::Rendering::Vulkan
 
 		command_pool = new CommandPool(this);
 
+		deletion_queue = new DeletionQueue();
+
 		window->createSwapchain();
 	}
 
@@ -87,6 +101,9 @@ namespace Engine::Rendering::Vulkan
 	{
 		logical_device->waitIdle();
 
+		// Retired objects may hold resources of any of the below
+		delete deletion_queue;
+
 		delete window;
 
 		delete command_pool;
@@ -97,7 +114,7 @@ namespace Engine::Rendering::Vulkan
 
 		delete physical_device;
 
-		glfwTerminate();
+		if (!headless) { glfwTerminate(); }
 	}
 
 #pragma endregion
@@ -126,8 +143,13 @@ namespace Engine::Rendering::Vulkan
 		}
 
 		// Get extensions required by GLFW
+		// (a headless instance presents nothing and so requires no surface extensions)
 		uint32_t	 glfw_extension_count = 0;
-		const char** glfw_extensions = glfwGetRequiredInstanceExtensions(&glfw_extension_count);
+		const char** glfw_extensions	  = nullptr;
+		if (!headless)
+		{
+			glfw_extensions = glfwGetRequiredInstanceExtensions(&glfw_extension_count);
+		}
 
 		// Get our required extensions
 		std::vector<const char*> instance_extensions(
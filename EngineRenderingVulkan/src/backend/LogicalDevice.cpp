@@ -24,7 +24,7 @@ namespace Engine::Rendering::Vulkan
 
 #pragma region Public
 
-	LogicalDevice::LogicalDevice(InstanceOwned::value_t with_instance, const Surface& with_surface)
+	LogicalDevice::LogicalDevice(InstanceOwned::value_t with_instance, const Surface* with_surface)
 		: InstanceOwned(with_instance), vk::raii::Device(createDevice(with_instance, with_surface))
 	{
 		// Get queue handles
@@ -36,7 +36,7 @@ namespace Engine::Rendering::Vulkan
 
 #pragma region Private
 
-	vk::raii::Device LogicalDevice::createDevice(Instance* with_instance, const Surface& with_surface)
+	vk::raii::Device LogicalDevice::createDevice(Instance* with_instance, const Surface* with_surface)
 	{
 		const auto* physical_device = with_instance->getPhysicalDevice();
 
@@ -84,6 +84,9 @@ namespace Engine::Rendering::Vulkan
 		vk::PhysicalDeviceFeatures2 device_features2 = physical_device->getFeatures2();
 		device_features2.pNext						 = &device_robustness_features;
 
+		// Swapchain extension is only needed if we present to a surface
+		const auto device_extensions = DeviceScore::getRequiredExtensions(with_surface != nullptr);
+
 		// Logical device creation information
 		vk::DeviceCreateInfo create_info{
 			.pNext					 = &device_features2,
@@ -91,8 +94,8 @@ namespace Engine::Rendering::Vulkan
 			.pQueueCreateInfos		 = queue_create_infos.data(),
 			.enabledLayerCount		 = static_cast<uint32_t>(device_validation_layers.size()),
 			.ppEnabledLayerNames	 = device_validation_layers.data(),
-			.enabledExtensionCount	 = static_cast<uint32_t>(DeviceScore::device_extensions.size()),
-			.ppEnabledExtensionNames = DeviceScore::device_extensions.data(),
+			.enabledExtensionCount	 = static_cast<uint32_t>(device_extensions.size()),
+			.ppEnabledExtensionNames = device_extensions.data(),
 			.pEnabledFeatures		 = nullptr,
 		};
 
@@ -68,7 +68,7 @@ namespace Engine::Rendering::Vulkan
 	}
 
 	std::optional<QueueFamilyIndices> PhysicalDevice::findVulkanQueueFamilies(
-		const Surface& with_surface
+		const Surface* with_surface
 	) const
 	{
 		QueueFamilyIndices indices;
@@ -88,7 +88,7 @@ namespace Engine::Rendering::Vulkan
 			}
 
 			// check surface support
-			if (with_surface.queryQueueSupport(*this, indice))
+			if (with_surface != nullptr && with_surface->queryQueueSupport(*this, indice))
 			{
 				indices.present_family = indice;
 				present_found		   = true;
@@ -97,6 +97,13 @@ namespace Engine::Rendering::Vulkan
 			indice++;
 		}
 
+		// Nothing to present to, the graphics queue is used in its place
+		if (with_surface == nullptr && graphics_found)
+		{
+			indices.present_family = indices.graphics_family;
+			present_found		   = true;
+		}
+
 		if (graphics_found && present_found)
 		{
 			return indices;
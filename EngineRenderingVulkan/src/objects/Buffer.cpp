@@ -8,6 +8,7 @@
 #include "objects/CommandPool.hpp"
 #include "vulkan/vulkan_raii.hpp"
 
+#include <memory>
 #include <vector>
 
 namespace Engine::Rendering::Vulkan
@@ -61,8 +62,6 @@ namespace Engine::Rendering::Vulkan
 
 	Buffer::~Buffer()
 	{
-		device->waitIdle();
-
 		vmaFreeMemory(allocator->getHandle(), allocation);
 	}
 
@@ -129,6 +128,34 @@ namespace Engine::Rendering::Vulkan
 		with_commandbuffer.queueSubmit(with_device->getGraphicsQueue());
 	}
 
+	VertexBuffer::VertexBuffer(
+		LogicalDevice*						with_device,
+		MemoryAllocator*					with_allocator,
+		CommandBuffer&						with_commandbuffer,
+		const std::vector<RenderingVertex>& vertices,
+		std::unique_ptr<StagingBuffer>&		out_staging
+	)
+		: Buffer(
+			  with_device,
+			  with_allocator,
+			  sizeof(vertices[0]) * vertices.size(),
+			  vk::BufferUsageFlagBits::eTransferDst |
+				  vk::BufferUsageFlagBits::eVertexBuffer,
+			  vk::MemoryPropertyFlagBits::eDeviceLocal
+		  )
+	{
+		out_staging = std::make_unique<StagingBuffer>(
+			with_device,
+			with_allocator,
+			vertices.data(),
+			buffer_size
+		);
+
+		// Copy into final buffer
+		with_commandbuffer
+			.copyBufferBuffer(out_staging.get(), this, {vk::BufferCopy{0, 0, buffer_size}});
+	}
+
 	UniformBuffer::UniformBuffer(
 		LogicalDevice*	 with_device,
 		MemoryAllocator* with_allocator,
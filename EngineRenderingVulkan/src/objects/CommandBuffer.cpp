@@ -70,4 +70,29 @@ namespace Engine::Rendering::Vulkan
 		to_queue.waitIdle();
 	}
 
+	void CommandBuffer::queueSubmitAsync(vk::raii::Queue& to_queue)
+	{
+		to_queue.submit(vk::SubmitInfo{
+			.commandBufferCount = 1,
+			.pCommandBuffers	= &**this,
+		});
+	}
+
+	void CommandBuffer::barrierTransferToVertexInput()
+	{
+		vk::MemoryBarrier barrier{
+			.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+			.dstAccessMask = vk::AccessFlagBits::eVertexAttributeRead
+		};
+
+		pipelineBarrier(
+			vk::PipelineStageFlagBits::eTransfer,
+			vk::PipelineStageFlagBits::eVertexInput,
+			{},
+			barrier,
+			{},
+			{}
+		);
+	}
+
 } // namespace Engine::Rendering::Vulkan
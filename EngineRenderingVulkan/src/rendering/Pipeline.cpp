@@ -2,6 +2,7 @@
 
 #include "fwd.hpp"
 
+#include "Profiling.hpp"
 #include "backend/Instance.hpp"
 #include "backend/LogicalDevice.hpp"
 #include "common/StructDefs.hpp"
@@ -27,11 +28,16 @@ namespace Engine::Rendering::Vulkan
 		InstanceOwned::value_t		 with_instance,
 		const ShaderCompiler&		 with_shader_compiler,
 		RenderPass*					 with_render_pass,
+		vk::DescriptorSetLayout		 with_frame_set_layout,
 		PipelineSettings			 settings,
-		const std::filesystem::path& shader_path
+		const std::filesystem::path& shader_path,
+		uint32_t					 with_id
 	)
-		: InstanceOwned(with_instance), HoldsVMA(with_instance->getGraphicMemoryAllocator())
+		: InstanceOwned(with_instance), HoldsVMA(with_instance->getGraphicMemoryAllocator()),
+		  id(with_id)
 	{
+		PROFILE_ZONE_CATEGORY("Pipeline::Pipeline", "pipeline");
+
 		LogicalDevice* logical_device = instance->getLogicalDevice();
 
 		assert(!settings.shader.empty() && "A valid shader for this pipeline is required!");
@@ -89,7 +95,7 @@ namespace Engine::Rendering::Vulkan
 		/************************************/
 		// Create Vulkan Descriptor Set Layout
 
-		// Binding 0 of vertex shader always must be uniform buffer
+		// Binding 0 of vertex shader always must be uniform buffer (per-object data)
 		settings.descriptor_settings.emplace(
 			0,
 			DescriptorBindingSetting{
@@ -134,9 +140,15 @@ namespace Engine::Rendering::Vulkan
 		/************************************/
 		// Create Graphics Pipeline Layout
 
+		// Set 0 is shared by all pipelines, set 1 belongs to this pipeline's users
+		const std::array<vk::DescriptorSetLayout, 2> set_layouts = {
+			with_frame_set_layout,
+			*descriptor_set_layout
+		};
+
 		vk::PipelineLayoutCreateInfo pipeline_layout_info{
-			.setLayoutCount = 1,
-			.pSetLayouts	= &*descriptor_set_layout
+			.setLayoutCount = static_cast<uint32_t>(set_layouts.size()),
+			.pSetLayouts	= set_layouts.data()
 		};
 
 		pipeline_layout = logical_device->createPipelineLayout(pipeline_layout_info);
@@ -157,6 +169,7 @@ namespace Engine::Rendering::Vulkan
 		// Make local copy of input assembly
 		const auto input_assembly =
 			PipelineSettings::getInputAssemblySettings(settings.input_topology);
+		const auto depth_stencil = PipelineSettings::getDepthStencilSettings(settings.depth_write);
 
 		vk::GraphicsPipelineCreateInfo pipeline_info{
 			.stageCount			 = static_cast<uint32_t>(shader_stages.size()),
@@ -169,7 +182,7 @@ namespace Engine::Rendering::Vulkan
 			.pMultisampleState	 = PipelineSettings::getMultisamplingSettings(
 				  instance->getPhysicalDevice()->getMSAASamples()
 			  ),
-			.pDepthStencilState = PipelineSettings::getDepthStencilSettings(),
+			.pDepthStencilState = &depth_stencil,
 			.pColorBlendState	= PipelineSettings::getColorBlendSettings(),
 			.pDynamicState		= &dynamic_state,
 			.layout				= *pipeline_layout,
@@ -208,7 +221,12 @@ namespace Engine::Rendering::Vulkan
 		logical_device.updateDescriptorSets(with_writes, {});
 	}
 
-	void Pipeline::bindPipeline(
+	void Pipeline::bindPipeline(vk::CommandBuffer with_command_buffer)
+	{
+		with_command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, *native_handle);
+	}
+
+	void Pipeline::bindDescriptorSets(
 		UserData&		  userdata_ref,
 		vk::CommandBuffer with_command_buffer,
 		uint32_t		  current_frame
@@ -217,12 +235,10 @@ namespace Engine::Rendering::Vulkan
 		with_command_buffer.bindDescriptorSets(
 			vk::PipelineBindPoint::eGraphics,
 			*pipeline_layout,
-			0,
+			1,
 			*userdata_ref.getDescriptorSet(current_frame),
 			{}
 		);
-
-		with_command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, *native_handle);
 	}
 
 	Pipeline::UserData* Pipeline::allocateNewUserData()
@@ -3,13 +3,17 @@
 #include "Logging/Logging.hpp"
 
 #include "Exception.hpp"
+#include "backend/DeletionQueue.hpp"
 #include "backend/Instance.hpp"
+#include "backend/LogicalDevice.hpp"
+#include "common/StructDefs.hpp"
 #include "objects/Buffer.hpp"
 #include "rendering/Pipeline.hpp"
 #include "rendering/Swapchain.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <string_view>
@@ -29,7 +33,9 @@ namespace Engine::Rendering::Vulkan
 		: SupportsLogging(with_logger), InstanceOwned(with_instance),
 		  shader_path(std::move(with_shader_path)),
 		  compiler(std::make_unique<ShaderCompiler>(with_logger))
-	{}
+	{
+		createFrameResources();
+	}
 
 	PipelineManager::~PipelineManager()
 	{
@@ -70,8 +76,10 @@ namespace Engine::Rendering::Vulkan
 				instance,
 				*compiler,
 				instance->getWindow()->getSwapchain()->getRenderPass(),
+				*frame_set_layout,
 				with_settings,
-				shader_path
+				shader_path,
+				static_cast<uint32_t>(created_count)
 			),
 			// Pass a lambda deleter to remove it from the vector too
 			[&](Pipeline* ptr) {
@@ -81,12 +89,31 @@ namespace Engine::Rendering::Vulkan
 		);
 
 		pipelines.emplace_back(with_settings, pipeline);
+		created_count++;
 
 		auto* user_ref = new PipelineUserRef(instance, pipeline);
 
 		return user_ref;
 	}
 
+	void PipelineManager::bindFrameData(
+		vk::CommandBuffer		with_command_buffer,
+		uint32_t				current_frame,
+		const FrameUniformData& with_data
+	)
+	{
+		frame_uniform_buffers[current_frame]->memoryCopy(&with_data, sizeof(FrameUniformData));
+
+		// Pipeline layouts share set 0, so this stays bound across pipeline binds
+		with_command_buffer.bindDescriptorSets(
+			vk::PipelineBindPoint::eGraphics,
+			*frame_pipeline_layout,
+			0,
+			*frame_descriptor_sets[current_frame],
+			{}
+		);
+	}
+
 	PipelineUserRef::PipelineUserRef(
 		InstanceOwned::value_t	  with_instance,
 		std::shared_ptr<Pipeline> with_origin
@@ -98,12 +125,17 @@ namespace Engine::Rendering::Vulkan
 
 	PipelineUserRef::~PipelineUserRef()
 	{
+		// Frames in flight may still use the descriptor sets and uniform buffers,
+		// the origin is retired last so that the pipeline outlives them
+		DeletionQueue* deletion_queue = instance->getDeletionQueue();
+
 		for (auto* uniform_buffer : user_data->uniform_buffers)
 		{
-			delete uniform_buffer;
+			deletion_queue->retire(uniform_buffer);
 		}
 
-		delete user_data;
+		deletion_queue->retire(user_data);
+		deletion_queue->retire(std::move(origin));
 	}
 
 	void PipelineUserRef::updateDescriptorSets(per_frame_array<vk::WriteDescriptorSet> with_writes)
@@ -146,6 +178,85 @@ namespace Engine::Rendering::Vulkan
 		return {nullptr, reasons[reached_point]};
 	}
 
+	void PipelineManager::createFrameResources()
+	{
+		LogicalDevice* logical_device = instance->getLogicalDevice();
+
+		vk::DescriptorSetLayoutBinding binding{
+			.binding		 = 0,
+			.descriptorType	 = vk::DescriptorType::eUniformBuffer,
+			.descriptorCount = 1,
+			.stageFlags		 = vk::ShaderStageFlagBits::eVertex,
+		};
+
+		vk::DescriptorSetLayoutCreateInfo layout_create_info{
+			.bindingCount = 1,
+			.pBindings	  = &binding
+		};
+
+		frame_set_layout = logical_device->createDescriptorSetLayout(layout_create_info);
+
+		// Only used to bind set 0, compatible with every pipeline's layout for that set
+		vk::PipelineLayoutCreateInfo pipeline_layout_info{
+			.setLayoutCount = 1,
+			.pSetLayouts	= &*frame_set_layout
+		};
+
+		frame_pipeline_layout = logical_device->createPipelineLayout(pipeline_layout_info);
+
+		vk::DescriptorPoolSize pool_size{
+			.type			 = vk::DescriptorType::eUniformBuffer,
+			.descriptorCount = max_frames_in_flight
+		};
+
+		vk::DescriptorPoolCreateInfo pool_create_info{
+			.flags		   = {vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet},
+			.maxSets	   = max_frames_in_flight,
+			.poolSizeCount = 1,
+			.pPoolSizes	   = &pool_size
+		};
+
+		frame_descriptor_pool = logical_device->createDescriptorPool(pool_create_info);
+
+		std::vector<vk::DescriptorSetLayout> layouts(max_frames_in_flight, *frame_set_layout);
+		vk::DescriptorSetAllocateInfo		 alloc_info{
+				   .descriptorPool	   = *frame_descriptor_pool,
+				   .descriptorSetCount = static_cast<uint32_t>(layouts.size()),
+				   .pSetLayouts		   = layouts.data()
+		   };
+
+		frame_descriptor_sets = vk::raii::DescriptorSets(*logical_device, alloc_info);
+
+		per_frame_array<vk::DescriptorBufferInfo> buffer_infos{};
+		per_frame_array<vk::WriteDescriptorSet>	  writes{};
+
+		for (uint32_t frame_idx = 0; frame_idx < max_frames_in_flight; frame_idx++)
+		{
+			frame_uniform_buffers[frame_idx] = std::make_unique<UniformBuffer>(
+				logical_device,
+				instance->getGraphicMemoryAllocator(),
+				sizeof(FrameUniformData)
+			);
+
+			buffer_infos[frame_idx] = vk::DescriptorBufferInfo{
+				.buffer = *frame_uniform_buffers[frame_idx]->getHandle(),
+				.offset = 0,
+				.range	= sizeof(FrameUniformData)
+			};
+
+			writes[frame_idx] = vk::WriteDescriptorSet{
+				.dstSet			 = *frame_descriptor_sets[frame_idx],
+				.dstBinding		 = 0,
+				.dstArrayElement = 0,
+				.descriptorCount = 1,
+				.descriptorType	 = vk::DescriptorType::eUniformBuffer,
+				.pBufferInfo	 = &buffer_infos[frame_idx]
+			};
+		}
+
+		logical_device->updateDescriptorSets(writes, {});
+	}
+
 	void PipelineManager::pipelineDeallocCallback()
 	{
 		// Delete all entries that are expired
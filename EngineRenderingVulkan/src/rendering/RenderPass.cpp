@@ -13,7 +13,8 @@ namespace Engine::Rendering::Vulkan
 	RenderPass::RenderPass(
 		const PhysicalDevice* with_physical_device,
 		LogicalDevice*		  with_logical_device,
-		vk::Format			  with_format
+		vk::Format			  with_format,
+		vk::ImageLayout		  with_final_layout
 	)
 	{
 		const auto msaa_samples = with_physical_device->getMSAASamples();
@@ -48,7 +49,7 @@ namespace Engine::Rendering::Vulkan
 			.stencilLoadOp	= vk::AttachmentLoadOp::eDontCare,
 			.stencilStoreOp = vk::AttachmentStoreOp::eDontCare,
 			.initialLayout	= vk::ImageLayout::eUndefined,
-			.finalLayout	= vk::ImageLayout::ePresentSrcKHR
+			.finalLayout	= with_final_layout
 		};
 
 		vk::AttachmentReference color_attachment_ref{
@@ -30,66 +30,10 @@ namespace Engine::Rendering::Vulkan
 		const PhysicalDevice* physical_device = instance->getPhysicalDevice();
 		LogicalDevice*		  logical_device  = instance->getLogicalDevice();
 
-		// Query details for support of swapchains
-		SwapChainSupportDetails swap_chain_support =
-			with_surface->querySwapChainSupport(*physical_device);
-		surface_format =
-			Vulkan::Utility::chooseSwapSurfaceFormat(swap_chain_support.formats);
-
-		vk::PresentModeKHR present_mode =
-			Vulkan::Utility::chooseSwapPresentMode(swap_chain_support.present_modes);
-
-		QueueFamilyIndices queue_indices = logical_device->getQueueFamilies();
-
-		uint32_t queue_family_indices[] = {
-			queue_indices.graphics_family,
-			queue_indices.present_family
-		};
-
-		bool queue_families_same = queue_indices.graphics_family !=
-								   queue_indices.present_family;
-
-		vk::SwapchainCreateInfoKHR create_info{
-			.surface			   = with_surface->native_handle,
-			.minImageCount		   = with_count,
-			.imageFormat		   = surface_format.format,
-			.imageColorSpace	   = surface_format.colorSpace,
-			.imageExtent		   = with_extent,
-			.imageArrayLayers	   = 1,
-			.imageUsage			   = vk::ImageUsageFlagBits::eColorAttachment,
-			.imageSharingMode	   = queue_families_same ? vk::SharingMode::eConcurrent
-														 : vk::SharingMode::eExclusive,
-			.queueFamilyIndexCount = queue_families_same ? 2 : uint32_t{},
-			.pQueueFamilyIndices   = queue_families_same ? queue_family_indices : nullptr,
-			.preTransform		   = swap_chain_support.capabilities.currentTransform,
-			.compositeAlpha		   = vk::CompositeAlphaFlagBitsKHR::eOpaque,
-			.presentMode		   = present_mode,
-			.clipped			   = vk::True
-		};
-
-		native_handle = logical_device->createSwapchainKHR(create_info);
-
-		image_handles = native_handle.getImages();
-
-		// Create image views
-		// these will serve as the color resolve attachment
-		for (auto image_handle : image_handles)
-		{
-			vk::ImageViewCreateInfo view_create_info{
-				.image	  = image_handle,
-				.viewType = vk::ImageViewType::e2D,
-				.format	  = surface_format.format,
-				.subresourceRange =
-					{.aspectMask	 = vk::ImageAspectFlagBits::eColor,
-					 .baseMipLevel	 = 0,
-					 .levelCount	 = 1,
-					 .baseArrayLayer = 0,
-					 .layerCount	 = 1}
-			};
-
-			image_view_handles.push_back(logical_device->createImageView(view_create_info)
-			);
-		}
+		// Without a surface there is no presentation engine,
+		// the resolve attachments are plain offscreen images instead
+		if (with_surface != nullptr) { createPresentImages(with_surface, with_count); }
+		else { createOffscreenImages(with_count); }
 
 		vk::Format depth_format = physical_device->findSupportedDepthFormat();
 
@@ -116,16 +60,25 @@ namespace Engine::Rendering::Vulkan
 			vk::ImageAspectFlagBits::eColor
 		);
 
-		render_pass =
-			new RenderPass(physical_device, logical_device, surface_format.format);
+		render_pass = new RenderPass(
+			physical_device,
+			logical_device,
+			surface_format.format,
+			with_surface != nullptr ? vk::ImageLayout::ePresentSrcKHR
+									: vk::ImageLayout::eTransferSrcOptimal
+		);
 
 		size_t view_idx = 0;
 		for (auto& target : render_targets)
 		{
+			const vk::ImageView* resolve_view =
+				offscreen_images.empty() ? &*image_view_handles[view_idx]
+										 : &*offscreen_images[view_idx]->getNativeViewHandle();
+
 			FramebufferData fb_data = {
 				&*depth_image->getNativeViewHandle(),
 				&*color_image->getNativeViewHandle(),
-				&*image_view_handles[view_idx]
+				resolve_view
 			};
 			++view_idx;
 
@@ -150,6 +103,11 @@ namespace Engine::Rendering::Vulkan
 		{
 			delete target;
 		}
+
+		for (auto* image : offscreen_images)
+		{
+			delete image;
+		}
 	}
 
 	void Swapchain::beginRenderPass(CommandBuffer* with_buffer, size_t image_index)
@@ -200,6 +158,109 @@ namespace Engine::Rendering::Vulkan
 		command_buffer->end();
 	}
 
+#pragma endregion
+
+#pragma region Private
+
+	void Swapchain::createPresentImages(Surface* with_surface, uint32_t with_count)
+	{
+		const PhysicalDevice* physical_device = instance->getPhysicalDevice();
+		LogicalDevice*		  logical_device  = instance->getLogicalDevice();
+
+		// Query details for support of swapchains
+		SwapChainSupportDetails swap_chain_support =
+			with_surface->querySwapChainSupport(*physical_device);
+		surface_format =
+			Vulkan::Utility::chooseSwapSurfaceFormat(swap_chain_support.formats);
+
+		vk::PresentModeKHR present_mode =
+			Vulkan::Utility::chooseSwapPresentMode(swap_chain_support.present_modes);
+
+		QueueFamilyIndices queue_indices = logical_device->getQueueFamilies();
+
+		uint32_t queue_family_indices[] = {
+			queue_indices.graphics_family,
+			queue_indices.present_family
+		};
+
+		bool queue_families_same = queue_indices.graphics_family !=
+								   queue_indices.present_family;
+
+		vk::SwapchainCreateInfoKHR create_info{
+			.surface			   = with_surface->native_handle,
+			.minImageCount		   = with_count,
+			.imageFormat		   = surface_format.format,
+			.imageColorSpace	   = surface_format.colorSpace,
+			.imageExtent		   = extent,
+			.imageArrayLayers	   = 1,
+			.imageUsage			   = vk::ImageUsageFlagBits::eColorAttachment,
+			.imageSharingMode	   = queue_families_same ? vk::SharingMode::eConcurrent
+														 : vk::SharingMode::eExclusive,
+			.queueFamilyIndexCount = queue_families_same ? 2 : uint32_t{},
+			.pQueueFamilyIndices   = queue_families_same ? queue_family_indices : nullptr,
+			.preTransform		   = swap_chain_support.capabilities.currentTransform,
+			.compositeAlpha		   = vk::CompositeAlphaFlagBitsKHR::eOpaque,
+			.presentMode		   = present_mode,
+			.clipped			   = vk::True
+		};
+
+		native_handle = logical_device->createSwapchainKHR(create_info);
+
+		image_handles = native_handle.getImages();
+
+		// Create image views
+		// these will serve as the color resolve attachment
+		for (auto image_handle : image_handles)
+		{
+			vk::ImageViewCreateInfo view_create_info{
+				.image	  = image_handle,
+				.viewType = vk::ImageViewType::e2D,
+				.format	  = surface_format.format,
+				.subresourceRange =
+					{.aspectMask	 = vk::ImageAspectFlagBits::eColor,
+					 .baseMipLevel	 = 0,
+					 .levelCount	 = 1,
+					 .baseArrayLayer = 0,
+					 .layerCount	 = 1}
+			};
+
+			image_view_handles.push_back(logical_device->createImageView(view_create_info)
+			);
+		}
+	}
+
+	void Swapchain::createOffscreenImages(uint32_t with_count)
+	{
+		const PhysicalDevice* physical_device = instance->getPhysicalDevice();
+
+		// Prefer the same format a surface would usually give us
+		surface_format = vk::SurfaceFormatKHR{
+			.format = physical_device->findSupportedFormat(
+				{vk::Format::eB8G8R8A8Srgb, vk::Format::eR8G8B8A8Srgb},
+				vk::ImageTiling::eOptimal,
+				vk::FormatFeatureFlagBits::eColorAttachment
+			),
+			.colorSpace = vk::ColorSpaceKHR::eSrgbNonlinear
+		};
+
+		// These serve as the color resolve attachment,
+		// transfer source so that the result can be read back
+		for (uint32_t idx = 0; idx < with_count; idx++)
+		{
+			offscreen_images.push_back(new ViewedImage(
+				instance->getLogicalDevice(),
+				instance->getGraphicMemoryAllocator(),
+				{extent.width, extent.height},
+				vk::SampleCountFlagBits::e1,
+				surface_format.format,
+				vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc,
+				vk::ImageAspectFlagBits::eColor
+			));
+		}
+	}
+
+#pragma endregion
+
 	SyncObjects::SyncObjects(vk::raii::Device& with_device)
 	{
 		static constexpr vk::SemaphoreCreateInfo semaphore_create_info{};
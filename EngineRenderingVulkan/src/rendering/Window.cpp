@@ -3,6 +3,7 @@
 #include "Rendering/Transform.hpp"
 
 #include "Exception.hpp"
+#include "backend/DeletionQueue.hpp"
 #include "backend/Instance.hpp"
 #include "rendering/Swapchain.hpp"
 #include "vulkan/vulkan_enums.hpp"
@@ -32,6 +33,13 @@ namespace Engine::Rendering::Vulkan
 	)
 		: InstanceOwned(with_instance), size(with_size)
 	{
+		// Reset all status bits to 0
+		memset(&status, 0, sizeof(StatusBits));
+
+		// Headless windows have no native window or surface,
+		// the swapchain will render into offscreen images instead
+		if (instance->isHeadless()) { return; }
+
 		for (const auto& [hint, value] : with_hints)
 		{
 			glfwWindowHint(hint, value);
@@ -41,9 +49,6 @@ namespace Engine::Rendering::Vulkan
 		// and don't need glfw to load any API for us
 		glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
 
-		// Reset all status bits to 0
-		memset(&status, 0, sizeof(StatusBits));
-
 		native_handle = glfwCreateWindow(
 			static_cast<int>(size.x),
 			static_cast<int>(size.y),
@@ -81,6 +86,8 @@ namespace Engine::Rendering::Vulkan
 	{
 		delete swapchain;
 
+		if (native_handle == nullptr) { return; }
+
 		(*instance->getHandle()).destroySurfaceKHR(surface.native_handle);
 
 		glfwDestroyWindow(native_handle);
@@ -89,6 +96,8 @@ namespace Engine::Rendering::Vulkan
 	// NOLINTNEXTLINE(readability-make-member-function-const) This function modifies internal state
 	void Window::setVisibility(bool visible)
 	{
+		if (native_handle == nullptr) { return; }
+
 		if (visible) { glfwShowWindow(native_handle); }
 		else { glfwHideWindow(native_handle); }
 	}
@@ -97,16 +106,37 @@ namespace Engine::Rendering::Vulkan
 	void Window::setShouldClose(bool should_close)
 	{
 		assert(should_close == true);
+
+		if (native_handle == nullptr)
+		{
+			headless_should_close = should_close;
+			return;
+		}
+
 		glfwSetWindowShouldClose(native_handle, static_cast<int>(should_close));
 	}
 
 	bool Window::getShouldClose() const
 	{
+		if (native_handle == nullptr) { return headless_should_close; }
+
 		return glfwWindowShouldClose(native_handle) != 0;
 	}
 
 	void Window::createSwapchain()
 	{
+		// Without a surface, render into max_frames_in_flight offscreen images
+		if (native_handle == nullptr)
+		{
+			swapchain = new Swapchain(
+				instance,
+				nullptr,
+				{static_cast<uint32_t>(size.x), static_cast<uint32_t>(size.y)},
+				max_frames_in_flight
+			);
+			return;
+		}
+
 		// Get device and surface Swap Chain capabilities
 		SwapChainSupportDetails swap_chain_support =
 			surface.querySwapChainSupport(*instance->getPhysicalDevice());
@@ -158,10 +188,17 @@ namespace Engine::Rendering::Vulkan
 		// (fence has to be reset before being used again)
 		logical_device->resetFences(*render_target.sync_objects.in_flight);
 
+		DeletionQueue* deletion_queue = instance->getDeletionQueue();
+		deletion_queue->beginFrame();
+
+		const bool is_headless = (native_handle == nullptr);
+
 		// Index of framebuffer in vk_swap_chain_framebuffers
-		uint32_t image_index = 0;
+		// (offscreen images are used in the same order as frames)
+		uint32_t image_index = current_frame;
 		// Acquire render target
 		// the render target is an image in the swap chain
+		if (!is_headless)
 		{
 			vk::Result result;
 			std::tie(result, image_index) = swapchain->getHandle().acquireNextImage(
@@ -191,23 +228,27 @@ namespace Engine::Rendering::Vulkan
 		vk::PipelineStageFlags wait_stages[] = {vk::PipelineStageFlagBits::eColorAttachmentOutput};
 		std::array<vk::Semaphore, 1> signal_semaphores = {*render_target.sync_objects.present_ready};
 
+		// Nothing is acquired or presented when headless, so there is nothing to wait on or signal
 		vk::SubmitInfo submit_info{
-			.waitSemaphoreCount	  = 1,
+			.waitSemaphoreCount	  = is_headless ? 0 : uint32_t{1},
 			.pWaitSemaphores	  = wait_semaphores,
 			.pWaitDstStageMask	  = wait_stages,
 			.commandBufferCount	  = 1,
 			.pCommandBuffers	  = command_buffers,
-			.signalSemaphoreCount = static_cast<uint32_t>(signal_semaphores.size()),
+			.signalSemaphoreCount = is_headless ? 0 : static_cast<uint32_t>(signal_semaphores.size()),
 			.pSignalSemaphores	  = signal_semaphores.data()
 		};
 
 		// Submit to queue
 		// passed fence will be signaled when command buffer execution is finished
 		logical_device->getGraphicsQueue().submit(submit_info, *render_target.sync_objects.in_flight);
+		deletion_queue->endFrame();
 
 		// Increment current frame
 		current_frame = (current_frame + 1) % max_frames_in_flight;
 
+		if (is_headless) { return; }
+
 		vk::SwapchainKHR swap_chains[] = {*swapchain->getHandle()};
 
 		// Present current image to the screen
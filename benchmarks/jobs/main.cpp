@@ -0,0 +1,160 @@
+#include "JobSystem.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace
+{
+	using Engine::Base::JobHandle;
+	using Engine::Base::JobSystem;
+
+	struct Result
+	{
+		const char* name;
+		size_t		jobs;
+		double		seconds;
+		uint64_t	stolen;
+	};
+
+	// Small amount of work per job, so that scheduling dominates
+	void spin(std::atomic<uint64_t>& sink)
+	{
+		uint64_t value = 0;
+		for (uint64_t idx = 0; idx < 64; idx++) { value += idx * idx; }
+
+		sink.fetch_add(value, std::memory_order_relaxed);
+	}
+
+	Result measure(const char* name, JobSystem& jobs, const std::function<size_t()>& run)
+	{
+		const uint64_t stolen_before = jobs.getStats().stolen;
+		const auto	   start		 = std::chrono::steady_clock::now();
+
+		const size_t job_count = run();
+
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		return {
+			.name	 = name,
+			.jobs	 = job_count,
+			.seconds = elapsed.count(),
+			.stolen	 = jobs.getStats().stolen - stolen_before
+		};
+	}
+
+	/**
+	 * Independent jobs scheduled from the main thread, spread over all workers
+	 */
+	size_t runFlat(JobSystem& jobs, size_t job_count, std::atomic<uint64_t>& sink)
+	{
+		std::vector<JobHandle> handles;
+		handles.reserve(job_count);
+
+		for (size_t idx = 0; idx < job_count; idx++)
+		{
+			handles.push_back(jobs.schedule([&sink]() { spin(sink); }));
+		}
+
+		for (const auto& handle : handles) { jobs.wait(handle); }
+
+		return job_count;
+	}
+
+	/**
+	 * Jobs scheduled by a single worker, other workers only get them by stealing
+	 */
+	size_t runSpawned(JobSystem& jobs, size_t job_count, std::atomic<uint64_t>& sink)
+	{
+		std::vector<JobHandle> handles(job_count);
+
+		const JobHandle root = jobs.schedule([&]() {
+			for (auto& handle : handles)
+			{
+				handle = jobs.schedule([&sink]() { spin(sink); });
+			}
+		});
+
+		jobs.wait(root);
+		for (const auto& handle : handles) { jobs.wait(handle); }
+
+		return job_count + 1;
+	}
+
+	/**
+	 * Chunks of a parallel-for, one element per job
+	 */
+	size_t runParallelFor(JobSystem& jobs, size_t job_count, std::atomic<uint64_t>& sink)
+	{
+		jobs.wait(jobs.parallelFor(job_count, 1, [&sink](size_t, size_t) { spin(sink); }));
+
+		// Plus the job joining the chunks
+		return job_count + 1;
+	}
+
+	/**
+	 * Continuations, every job waits for the previous one
+	 */
+	size_t runChain(JobSystem& jobs, size_t job_count, std::atomic<uint64_t>& sink)
+	{
+		JobHandle last;
+		for (size_t idx = 0; idx < job_count; idx++)
+		{
+			last = jobs.then(last, [&sink]() { spin(sink); });
+		}
+
+		jobs.wait(last);
+
+		return job_count;
+	}
+} // namespace
+
+/**
+ * Usage: jobbenchmark [job count] [worker count]
+ *
+ * Measures job throughput of the JobSystem in a few scheduling patterns,
+ * a worker count of 0 uses one less than the number of cores.
+ */
+int main(int argc, char** argv)
+{
+	const size_t job_count	  = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+	const size_t worker_count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 0;
+
+	JobSystem jobs(worker_count);
+
+	// Keeps the work of the jobs from being optimized away
+	std::atomic<uint64_t> sink = 0;
+
+	const std::vector<Result> results = {
+		measure("flat", jobs, [&]() { return runFlat(jobs, job_count, sink); }),
+		measure("spawned", jobs, [&]() { return runSpawned(jobs, job_count, sink); }),
+		measure("parallelFor", jobs, [&]() { return runParallelFor(jobs, job_count, sink); }),
+		measure("chain", jobs, [&]() { return runChain(jobs, job_count / 10, sink); }),
+	};
+
+	std::printf(
+		"%zu workers, checksum %llu\n",
+		jobs.getWorkerCount(),
+		static_cast<unsigned long long>(sink.load())
+	);
+	std::printf("%-12s %10s %10s %14s %10s\n", "pattern", "jobs", "ms", "jobs/s", "stolen");
+
+	for (const auto& result : results)
+	{
+		std::printf(
+			"%-12s %10zu %10.2f %14.0f %10llu\n",
+			result.name,
+			result.jobs,
+			result.seconds * 1000.0,
+			static_cast<double>(result.jobs) / result.seconds,
+			static_cast<unsigned long long>(result.stolen)
+		);
+	}
+
+	return 0;
+}
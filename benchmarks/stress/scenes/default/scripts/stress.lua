@@ -0,0 +1,125 @@
+local params = require("stress_params")
+
+local sprites = {}
+local texts = {}
+local hierarchy_roots = {}
+
+local elapsed = 0.0
+
+-- Supplies the generator with the size of the chunk it builds
+function chunk_supplier(world_x, world_z)
+	return params.chunk_size
+end
+
+onInit = function(event)
+	local asset_manager = event.engine:getAssetManager()
+	local scene_manager = event.engine:getSceneManager()
+	local scene = scene_manager:getSceneCurrent()
+
+	-- Key state has to reach Lua as a boolean, a number would always be truthy
+	local f25_key = 314
+	assert(event.engine:isKeyDown(f25_key) == false, "Released key does not read as false")
+
+	local font = asset_manager:getFont("myfont")
+	local sprite_texture = asset_manager:getTexture("sprite")
+	local atlas_texture = asset_manager:getTexture("atlas")
+
+	scene_manager:setCameraTransform(0.0, 20.0, 0.0)
+	scene_manager:setCameraRotation(45.0, 225.0)
+
+	-- Moving sprites
+	for i = 1, params.sprites do
+		local object = createSceneObject(event.engine, "renderer_2d", "sprite", "sprite", {
+			{"texture", sprite_texture}
+		}, {})
+		object:setPosition(math.random(), math.random(), 0.0)
+		object:setSize(0.02, 0.02, 1.0)
+		scene:addObject(string.format("sprite_%i", i), object)
+
+		sprites[i] = {
+			object = object,
+			phase = math.random() * 2 * math.pi
+		}
+	end
+
+	-- Texts rebuilt every frame
+	for i = 1, params.texts do
+		local object = createSceneObject(event.engine, "renderer_2d", "text", "text",
+			{ {"font", font} }, { {"text", "0"} }
+		)
+		object:setPosition(((i - 1) % 10) * 0.1, math.floor((i - 1) / 10) * 0.03, -0.01)
+		object:setSize(16, 16, 1.0)
+		scene:addObject(string.format("text_%i", i), object)
+
+		texts[i] = object
+	end
+
+	-- Deep hierarchies, each object is a child of the previous one
+	for i = 1, params.hierarchies do
+		local parent = nil
+
+		for depth = 1, params.hierarchy_depth do
+			local object = createSceneObject(event.engine, "renderer_2d", "sprite", "sprite", {
+				{"texture", sprite_texture}
+			}, {})
+			object:setSize(0.01, 0.01, 1.0)
+
+			if parent == nil then
+				object:setPosition(i / (params.hierarchies + 1), 0.5, -0.02)
+				hierarchy_roots[i] = object
+			else
+				object:setPosition(0.01, 0.0, 0.0)
+				parent:addChild(object)
+			end
+
+			scene:addObject(string.format("hierarchy_%i_%i", i, depth), object)
+			parent = object
+		end
+	end
+
+	-- Generator chunks laid out in a square grid
+	local stressgen_script = asset_manager:getScript("stressgen")
+	local supplier_script = asset_manager:getScript("stress")
+
+	local grid_size = math.ceil(math.sqrt(params.chunks))
+	for i = 0, params.chunks - 1 do
+		local chunk_x = i % grid_size
+		local chunk_z = math.floor(i / grid_size)
+
+		local object = createSceneObject(event.engine, "renderer_3d", "generator", "terrain",
+			{ {"texture", atlas_texture} }, { {"generator", {{stressgen_script, "generate_fn"}, {supplier_script, "chunk_supplier"}}} }
+		)
+		object:setPosition(chunk_x * params.chunk_size, 0.0, chunk_z * params.chunk_size)
+		object:setSize(1, 1, 1)
+		object:setRotation(0, 0, 0)
+		scene:addObject(string.format("chunk_%i", i), object)
+	end
+
+	-- Parameters are written with the metrics
+	for name, value in pairs(params) do
+		event.engine:setStatCounter(name, value)
+	end
+
+	return 0
+end
+
+onUpdate = function(event)
+	elapsed = elapsed + event.deltaTime
+
+	for i = 1, #sprites do
+		local sprite = sprites[i]
+		local x, y, z = sprite.object:getPosition()
+
+		sprite.object:setPosition(x, 0.5 + 0.4 * math.sin(elapsed + sprite.phase), z)
+	end
+
+	for i = 1, #texts do
+		meshBuilderSupplyData(texts[i].meshbuilder, "text", string.format("%i: %.3f", i, elapsed))
+	end
+
+	for i = 1, #hierarchy_roots do
+		hierarchy_roots[i]:setRotation(0, 0, elapsed * 45.0)
+	end
+
+	return 0
+end
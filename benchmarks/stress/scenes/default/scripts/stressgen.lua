@@ -0,0 +1,28 @@
+-- Generates a heightfield of top faces, one quad per column of the chunk
+local emitQuad = function(x, y, z)
+	local corners = {
+		{0, 0, 0, 0},
+		{1, 0, 1, 0},
+		{1, 1, 1, 1},
+
+		{1, 1, 1, 1},
+		{0, 1, 0, 1},
+		{0, 0, 0, 0}
+	}
+
+	for i = 1, #corners do
+		local x_off, z_off, u, v = unpack(corners[i])
+		coroutine.yield(u * 0.125, v * 0.5, {0, 1, 0}, {0, 0, 0}, x + x_off, y, z + z_off)
+	end
+end
+
+generate_fn = function(supplier, world_x, world_y, world_z)
+	local chunk_size = supplier(world_x, world_z)
+
+	for z = 0, chunk_size - 1 do
+		for x = 0, chunk_size - 1 do
+			local height = math.floor(4 + 3 * math.sin((world_x + x) * 0.3) * math.cos((world_z + z) * 0.3))
+			emitQuad(x, height, z)
+		end
+	end
+end
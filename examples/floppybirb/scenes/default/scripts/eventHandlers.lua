@@ -1,11 +1,8 @@
 -- Include modules
 
 -- Debugging data
-local deltaTime_accum = 0.0
-local deltaTime_count = 0
--- Minimum & Maximum reached deltatime
-local deltaTime_max = 0.0
-local deltaTime_min = 2000.0
+-- Time since the debug info was last refreshed
+local debugInfo_timer = 0.0
 
 -----------------------
 --->  Game events  <---
@@ -67,10 +64,6 @@ onKeyUp = function(event)
 	end
 end
 
--- Minimum & Maximum reached deltatime
-local deltaTime_max = 0.0
-local deltaTime_min = 2000.0
-
 -- ON_UPDATE event
 -- 
 -- called every frame
@@ -79,28 +72,20 @@ local deltaTime_min = 2000.0
 -- and is the period between the last onUpdate and the current one
 --
 onUpdate = function(event)
-	deltaTime_accum = deltaTime_accum + event.deltaTime
-
-	deltaTime_max = math.max(deltaTime_max, event.deltaTime)
-	deltaTime_min = math.min(deltaTime_min, event.deltaTime)
-
-	deltaTime_count = deltaTime_count + 1
+	debugInfo_timer = debugInfo_timer + event.deltaTime
 
 	local asset_manager = event.engine:getAssetManager()
 	local scene_manager = event.engine:getSceneManager()
 	local scene = scene_manager:getSceneCurrent()
 
 	-- Updates frametime counter, recommend to leave this here for debugging purposes
-	if deltaTime_accum >= 1.0 then
-		local deltaTime_avg = deltaTime_accum / deltaTime_count
-		--print(string.format("Frametime is: %f ms!", deltaTime_accum / deltaTime_count * 1000))
+	if debugInfo_timer >= 1.0 then
+		-- Statistics of recent frames are collected by the engine
+		local frame = event.engine:getFrameStats("frame")
 		local object = scene:findObject("_debug_info")
-		meshBuilderSupplyData(object.meshbuilder, "text", string.format("avg: %fms\nmin: %fms\nmax: %fms", deltaTime_avg * 1000, deltaTime_min * 1000, deltaTime_max * 1000))
+		meshBuilderSupplyData(object.meshbuilder, "text", string.format("avg: %fms\np99: %fms\nmax: %fms", frame.mean, frame.p99, frame.max))
 
-		deltaTime_min = 2000.0
-		deltaTime_max = 0.0
-		deltaTime_accum = 0
-		deltaTime_count = 0
+		debugInfo_timer = 0.0
 	end
 
 	return 0
@@ -121,7 +106,7 @@ onInit = function(event)
 
 	-- Create frametime counter and add it to scene
 	local object = createSceneObject(event.engine, "renderer_2d", "text", "text",
-		{ {"font", font} }, { {"text", "avg: \nmin: \nmax: "} }
+		{ {"font", font} }, { {"text", "avg: \np99: \nmax: "} }
 	)
 	object:setPosition(0.0, 0.0, -0.01)
 	object:setSize(24, 24, 1.0)
@@ -135,6 +120,10 @@ onInit = function(event)
 	object:setSize(48, 48, 1.0)
 	scene:addObject("text_begin", object)
 
+	-- Start loading the game scene in the background
+	-- so that pressing space switches to it without a hitch
+	scene_manager:preloadScene("floppygame")
+
 	-- Set-up camera
 	-- (this is essentially unnecessary for 2D-only scenes)
 	scene_manager:setCameraTransform(0.0, 0.0, 0.0)
@@ -6,11 +6,8 @@ local config = require("config")
 ---->  Game data  <----
 
 -- Debugging data
-local deltaTime_accum = 0.0
-local deltaTime_count = 0
--- Minimum & Maximum reached deltatime
-local deltaTime_max = 0.0
-local deltaTime_min = 2000.0
+-- Time since the debug info was last refreshed
+local debugInfo_timer = 0.0
 
 -- Related to spawning pipes
 local spawn_pipe_every = config.spawn_pipe_every_start
@@ -164,10 +161,6 @@ onKeyUp = function(event)
 	end
 end
 
--- Minimum & Maximum reached deltatime
-local deltaTime_max = 0.0
-local deltaTime_min = 2000.0
-
 -- ON_UPDATE event
 -- 
 -- called every frame
@@ -176,12 +169,7 @@ local deltaTime_min = 2000.0
 -- and is the period between the last onUpdate and the current one
 --
 onUpdate = function(event)
-	deltaTime_accum = deltaTime_accum + event.deltaTime
-
-	deltaTime_max = math.max(deltaTime_max, event.deltaTime)
-	deltaTime_min = math.min(deltaTime_min, event.deltaTime)
-
-	deltaTime_count = deltaTime_count + 1
+	debugInfo_timer = debugInfo_timer + event.deltaTime
 
 	-- For profiling only!
 	if (game_score >= 250) then
@@ -193,16 +181,13 @@ onUpdate = function(event)
 	local scene = scene_manager:getSceneCurrent()
 
 	-- Updates frametime counter, recommend to leave this here for debugging purposes
-	if deltaTime_accum >= 1.0 then
-		local deltaTime_avg = deltaTime_accum / deltaTime_count
-		--print(string.format("Frametime is: %f ms!", deltaTime_accum / deltaTime_count * 1000))
+	if debugInfo_timer >= 1.0 then
+		-- Statistics of recent frames are collected by the engine
+		local frame = event.engine:getFrameStats("frame")
 		local object = scene:findObject("_debug_info")
-		meshBuilderSupplyData(object.meshbuilder, "text", string.format("avg: %fms\nmin: %fms\nmax: %fms", deltaTime_avg * 1000, deltaTime_min * 1000, deltaTime_max * 1000))
+		meshBuilderSupplyData(object.meshbuilder, "text", string.format("avg: %fms\np99: %fms\nmax: %fms", frame.mean, frame.p99, frame.max))
 
-		deltaTime_min = 2000.0
-		deltaTime_max = 0.0
-		deltaTime_accum = 0
-		deltaTime_count = 0
+		debugInfo_timer = 0.0
 	end
 
 	if (game_gameover_state == false and game_midgameover_state == false) then
@@ -247,14 +232,6 @@ onUpdate = function(event)
 				pipe1:setPosition(x1, y1, z1)
 				pipe2:setPosition(x2, y2, z2)
 
-				-- Check collisions with both pipes
-				if util.checkCollisions2DBox(birbx, birby, util.pxToScreenX(config.birb_x_size), util.pxToScreenY(config.birb_y_size), x1, y1, util.pxToScreenX(config.pipe_x_size), util.pxToScreenY(config.pipe_y_size)) or -- pipe 1
-				   util.checkCollisions2DBox(birbx, birby, util.pxToScreenX(config.birb_x_size), util.pxToScreenY(config.birb_y_size), x2, y2, util.pxToScreenX(config.pipe_x_size), util.pxToScreenY(config.pipe_y_size))	 -- pipe 2
-				then
-					gameOnGameOver(event.engine, asset_manager, scene_manager)
-					return 0
-				end
-
 				-- Add score by colliding with a wall after the pipes
 				if util.checkCollisions2DBox(birbx, birby, util.pxToScreenX(config.birb_x_size), util.pxToScreenY(config.birb_y_size), x2 + util.pxToScreenX(80), 0.0, util.pxToScreenX(80), 1.0) and
 				   pipeIdx > game_last_scored_pipe_idx
@@ -276,6 +253,16 @@ onUpdate = function(event)
 					spawn_pipe_first_idx = spawn_pipe_first_idx + 1
 				end
 			end
+
+			-- Check collisions with all pipes at once, only pipes are placed at this depth
+			local hit_pipes = scene:queryAABB("screen",
+				birbx, birby, -0.16,
+				birbx + util.pxToScreenX(config.birb_x_size), birby + util.pxToScreenY(config.birb_y_size), -0.14
+			)
+			if #hit_pipes > 0 then
+				gameOnGameOver(event.engine, asset_manager, scene_manager)
+				return 0
+			end
 		end
 		
 		-- Check collisions with grounds
@@ -334,7 +321,7 @@ onInit = function(event)
 
 	-- Create frametime counter and add it to scene
 	local object = createSceneObject(event.engine, "renderer_2d", "text", "text",
-		{ {"font", font} }, { {"text", "avg: \nmin: \nmax: "} }
+		{ {"font", font} }, { {"text", "avg: \np99: \nmax: "} }
 	)
 	object:setPosition(0.0, 0.0, -0.01)
 	object:setSize(24, 24, 1.0)
@@ -5,10 +5,8 @@ local game_defs = require("game_defs")
 require("perlin")
 
 -- Debugging data
-local deltaTime_accum = 0.0
-local deltaTime_count = 0
-local deltaTime_max = 0.0
-local deltaTime_min = 2000.0
+-- Time since the debug info was last refreshed
+local debugInfo_timer = 0.0
 
 local chunks_x = config.render_distance
 local chunks_z = config.render_distance
@@ -288,12 +286,7 @@ end
 -- and is the period between the last onUpdate and the current one
 --
 onUpdate = function(event)
-	deltaTime_accum = deltaTime_accum + event.deltaTime
-
-	deltaTime_max = math.max(deltaTime_max, event.deltaTime)
-	deltaTime_min = math.min(deltaTime_min, event.deltaTime)
-
-	deltaTime_count = deltaTime_count + 1
+	debugInfo_timer = debugInfo_timer + event.deltaTime
 
 	local asset_manager = event.engine:getAssetManager()
 	local scene_manager = event.engine:getSceneManager()
@@ -304,16 +297,13 @@ onUpdate = function(event)
 	end ]]
 
 	-- Updates frametime counter, recommend to leave this here for debugging purposes
-	if deltaTime_accum >= 1.0 then
-		local deltaTime_avg = deltaTime_accum / deltaTime_count
+	if debugInfo_timer >= 1.0 then
+		-- Statistics of recent frames are collected by the engine
+		local frame = event.engine:getFrameStats("frame")
 		local object = scene:findObject("_debug_info")
+		meshBuilderSupplyData(object.meshbuilder, "text", string.format("avg: %fms\np99: %fms\nmax: %fms", frame.mean, frame.p99, frame.max))
 
-		meshBuilderSupplyData(object.meshbuilder, "text", string.format("avg: %fms\nmin: %fms\nmax: %fms", deltaTime_avg * 1000, deltaTime_min * 1000, deltaTime_max * 1000))
-
-		deltaTime_min = 2000.0
-		deltaTime_max = 0.0
-		deltaTime_accum = 0
-		deltaTime_count = 0
+		debugInfo_timer = 0.0
 	end
 
 	local camx, camy, camz = scene_manager:getCameraTransform()
@@ -344,7 +334,7 @@ onInit = function(event)
 
 	-- Create frametime counter and add it to scene
 	local object0 = createSceneObject(event.engine, "renderer_2d", "text", "text",
-		{ {"font", font} }, { {"text", "avg: \nmin: \nmax: "} }
+		{ {"font", font} }, { {"text", "avg: \np99: \nmax: "} }
 	)
 	object0:setPosition(0.0, 0.0, -0.01)
 	object0:setSize(24, 24, 1.0)
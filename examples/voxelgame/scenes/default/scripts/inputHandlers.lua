@@ -1,29 +1,4 @@
 
--- ON_MOUSEMOVED event
--- 
--- this event is called when the mouse moved
---
--- while specifying event handlers is optional
--- it is left here for illustration purposes
--- (events for which no event handler is specified are discarded)
--- 
-onMouseMoved = function(event)
-	local mouseSpeed = 5.0;
-
-	local scene_manager = event.engine:getSceneManager()
-
-	local h, v = scene_manager:getCameraRotation()
-
-	--engine.logger.SimpleLog(string.format("X: %f Y: %f", event.mouse.x, event.mouse.y))
-
-	h = h + (mouseSpeed * event.deltaTime) * event.mouse.x
-	v = v + (mouseSpeed * event.deltaTime) * event.mouse.y
-
-	scene_manager:setCameraRotation(h, v)
-
-	return 0
-end
-
 local vectorCross = function(v1x, v1y, v1z, v2x, v2y, v2z)
 	-- x		= v1.y * v2.z - v2.y * v1.z
 	local out_x = v1y  * v2z  - v2y  * v1z;
@@ -45,13 +20,11 @@ local forwardVector = function(yaw, pitch)
 	return front_x, front_y, front_z
 end
 
-local keystates = {false, false, false, false, false, false}
-
 -- ON_KEYDOWN event
 -- 
 -- this event is called every time the engine receives a keypress
--- for non-toggleable keys this event may be fired multiple times
--- always check whether a key was unpressed when necessary
+-- held keys are polled in onMovementTick instead,
+-- this handler only reacts to single presses
 -- 
 onKeyDown = function(event)
 	-- Stop engine if ESC is pressed
@@ -59,75 +32,39 @@ onKeyDown = function(event)
 	--
 	if event.keycode == 256 then
 		event.engine:stop()
-		
-		return 0
-	end
-
-	local keycodeSwitchTbl = {
-	   [string.byte('W')] = function()
-			keystates[1] = true
-	   end,
-	   [string.byte('S')] = function()
-			keystates[2] = true
-	   end,
-	   [string.byte('A')] = function()
-			keystates[3] = true
-	   end,
-	   [string.byte('D')] = function()
-			keystates[4] = true
-	   end,
-	   [340] = function() -- shift key is value 340
-			keystates[5] = true
-	   end,
-	   [string.byte(' ')] = function() -- spacebar can be represented by space
-			keystates[6] = true
-	   end
-	};
-	
-	if keycodeSwitchTbl[event.keycode] ~= nil then
-	   keycodeSwitchTbl[event.keycode]();
 	end
 
 	return 0
 end
 
--- ON_KEYUP event
--- 
--- this event is called exactly once for every release of a key
--- 
-onKeyUp = function(event)
-	local keycodeSwitchTbl = {
-	   [string.byte('W')] = function()
-			keystates[1] = false
-	   end,
-	   [string.byte('S')] = function()
-			keystates[2] = false
-	   end,
-	   [string.byte('A')] = function()
-			keystates[3] = false
-	   end,
-	   [string.byte('D')] = function()
-			keystates[4] = false
-	   end,
-	   [340] = function() -- shift key is value 340
-			keystates[5] = false
-	   end,
-	   [string.byte(' ')] = function() -- spacebar can be represented by space
-			keystates[6] = false
-	   end
-	};
-
-	if keycodeSwitchTbl[event.keycode] ~= nil then
-		keycodeSwitchTbl[event.keycode]();
-	 end
-
-	return 0
-end
+-- Keys polled every tick, in the same order as the movement functions
+local movementKeys = {
+	string.byte('W'),
+	string.byte('S'),
+	string.byte('A'),
+	string.byte('D'),
+	340, -- shift key is value 340
+	string.byte(' ') -- spacebar can be represented by space
+}
 
 onMovementTick = function(event)
 	local moveSpeed = 15.0 * event.deltaTime;
-	  
-	local scene_manager = event.engine:getSceneManager()
+	local mouseSpeed = 5.0;
+
+	local engine = event.engine
+	local scene_manager = engine:getSceneManager()
+
+	-- Mouse movement of this frame, replaces an onMouseMoved handler
+	local mouse_x, mouse_y = engine:getMouseDelta()
+	if mouse_x ~= 0 or mouse_y ~= 0 then
+		local h, v = scene_manager:getCameraRotation()
+
+		h = h + (mouseSpeed * event.deltaTime) * mouse_x
+		v = v + (mouseSpeed * event.deltaTime) * mouse_y
+
+		scene_manager:setCameraRotation(h, v)
+	end
+
 	local camera_h, camera_v = scene_manager:getCameraRotation();
 
 	local pitch = math.rad(camera_v)
@@ -178,7 +115,7 @@ onMovementTick = function(event)
 	};
 	
 	for i = 1, #keycodeSwitchTbl do
-		if keystates[i] == true then
+		if engine:isKeyDown(movementKeys[i]) then
 			keycodeSwitchTbl[i]();
 
 			scene_manager:setCameraTransform(transform_x, transform_y, transform_z);
@@ -5,18 +5,28 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace
 {
 	struct StartupConfig
 	{
 		int verbosity_level = 0;
+
+		bool	 headless		  = false;
+		uint64_t headless_frames  = 0;
+		double	 headless_seconds = 0.0;
+
+		// Input recording to write or replay (empty = none)
+		std::string record_path;
+		std::string replay_path;
 	};
 
 // Debug builds should by default log more than release builds
@@ -121,6 +131,14 @@ namespace
 		try
 		{
 			engine->configFile("game/config.json");
+
+			if (config.headless)
+			{
+				engine->setHeadless(config.headless_frames, config.headless_seconds);
+			}
+
+			if (!config.record_path.empty()) { engine->recordInput(config.record_path.c_str()); }
+			if (!config.replay_path.empty()) { engine->replayInput(config.replay_path.c_str()); }
 		}
 		catch (const std::exception& e)
 		{
@@ -155,8 +173,30 @@ namespace
 	 */
 	void parseArg(StartupConfig& config, char* arg_str)
 	{
+		constexpr std::string_view frames_arg  = "--frames=";
+		constexpr std::string_view seconds_arg = "--seconds=";
+		constexpr std::string_view record_arg  = "--record=";
+		constexpr std::string_view replay_arg  = "--replay=";
+
 		if (strcmp(arg_str, "-v") == 0) { config.verbosity_level = 1; }
 		else if (strcmp(arg_str, "-vv") == 0) { config.verbosity_level = 2; }
+		else if (strcmp(arg_str, "--headless") == 0) { config.headless = true; }
+		else if (strncmp(arg_str, frames_arg.data(), frames_arg.size()) == 0)
+		{
+			config.headless_frames = std::strtoull(arg_str + frames_arg.size(), nullptr, 10);
+		}
+		else if (strncmp(arg_str, seconds_arg.data(), seconds_arg.size()) == 0)
+		{
+			config.headless_seconds = std::strtod(arg_str + seconds_arg.size(), nullptr);
+		}
+		else if (strncmp(arg_str, record_arg.data(), record_arg.size()) == 0)
+		{
+			config.record_path = arg_str + record_arg.size();
+		}
+		else if (strncmp(arg_str, replay_arg.data(), replay_arg.size()) == 0)
+		{
+			config.replay_path = arg_str + replay_arg.size();
+		}
 	}
 } // namespace
 
@@ -0,0 +1,73 @@
+#include "Exception.hpp"
+#include "SceneCompiler.hpp"
+#include "SceneFormat.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+	void writeFile(const std::filesystem::path& path, const std::vector<std::byte>& data)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			throw ENGINE_EXCEPTION(std::format("Could not open output file '{}'", path.string()));
+		}
+
+		file.write(
+			reinterpret_cast<const char*>(data.data()),
+			static_cast<std::streamsize>(data.size())
+		);
+	}
+} // namespace
+
+/**
+ * Usage: scenecompiler <scene directory> [output file]
+ *
+ * The output defaults to the scene.bin of the scene directory.
+ */
+int main(int argc, char** argv)
+{
+	if (argc < 2 || argc > 3)
+	{
+		std::fprintf(stderr, "Usage: %s <scene directory> [output file]\n", argv[0]);
+		return 1;
+	}
+
+	const std::filesystem::path scene_path = argv[1];
+
+	std::filesystem::path output_path = scene_path / Engine::SceneFormat::compiled_file_name;
+	if (argc == 3) { output_path = argv[2]; }
+
+	try
+	{
+		const std::vector<std::byte> compiled = Engine::SceneCompiler::compileDirectory(scene_path);
+
+		writeFile(output_path, compiled);
+
+		std::printf(
+			"Compiled '%s' into '%s' (%zu bytes)\n",
+			scene_path.string().c_str(),
+			output_path.string().c_str(),
+			compiled.size()
+		);
+	}
+	catch (const std::exception& e)
+	{
+		std::fprintf(
+			stderr,
+			"Failed compiling scene '%s'!\n%s\n",
+			scene_path.string().c_str(),
+			Engine::Base::unrollExceptions(e).c_str()
+		);
+		return 2;
+	}
+
+	return 0;
+}
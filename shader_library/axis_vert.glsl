@@ -1,9 +1,13 @@
 #version 450
 #pragma shader_stage(vertex)
 
-layout(binding = 0) uniform MAT {
-    mat4 viewProjection;
+layout(set = 0, binding = 0) uniform FRAME {
+    mat4 viewProjection[2];
+} frame_data;
+
+layout(set = 1, binding = 0) uniform MAT {
     mat4 model;
+    uint projection;
 } matrix_data;
 
 layout(location = 0) in vec3 inPosition;
@@ -14,6 +18,6 @@ layout(location = 3) in vec3 inNormal;
 layout(location = 0) out vec3 fragColor;
 
 void main() {
-    gl_Position = matrix_data.viewProjection * vec4(inPosition, 1.0);
+    gl_Position = frame_data.viewProjection[matrix_data.projection] * vec4(inPosition, 1.0);
     fragColor = inColor;
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #version 450
 #pragma shader_stage(fragment)
 
-layout(set = 0, binding = 1) uniform sampler2D texSampler[16];
+layout(set = 1, binding = 1) uniform sampler2D texSampler[16];
 
 layout(location = 0) in vec3 fragColor;
 layout(location = 1) in vec2 fragTexCoord;
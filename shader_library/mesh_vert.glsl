@@ -1,9 +1,14 @@
 #version 450
 #pragma shader_stage(vertex)
 
-layout(binding = 0) uniform MAT {
-    mat4 data;
-} mvp;
+layout(set = 0, binding = 0) uniform FRAME {
+    mat4 viewProjection[2];
+} frame_data;
+
+layout(set = 1, binding = 0) uniform MAT {
+    mat4 model;
+    uint projection;
+} matrix_data;
 
 layout(location = 0) in vec3 inPosition;
 layout(location = 1) in vec3 inColor;
@@ -15,7 +20,7 @@ layout(location = 1) out vec2 fragTexCoord;
 layout(location = 2) out vec3 fragNormal;
 
 void main() {
-    gl_Position = mvp.data * vec4(inPosition, 1.0);
+    gl_Position = frame_data.viewProjection[matrix_data.projection] * vec4(inPosition, 1.0);
 
     fragColor = inColor;
     fragTexCoord = inTexCoord;
@@ -1,9 +1,13 @@
 #version 450
 #pragma shader_stage(vertex)
 
-layout(binding = 0) uniform MAT {
-    mat4 viewProjection;
+layout(set = 0, binding = 0) uniform FRAME {
+    mat4 viewProjection[2];
+} frame_data;
+
+layout(set = 1, binding = 0) uniform MAT {
     mat4 model;
+    uint projection;
 } matrix_data;
 
 layout(location = 0) in vec3 inPosition;
@@ -15,7 +19,7 @@ layout(location = 0) out vec3 fragColor;
 layout(location = 1) out vec2 fragTexCoord;
 
 void main() {
-    gl_Position = (matrix_data.viewProjection * matrix_data.model) * vec4(inPosition, 1.0);
+    gl_Position = (frame_data.viewProjection[matrix_data.projection] * matrix_data.model) * vec4(inPosition, 1.0);
     fragColor = inColor;
     fragTexCoord = inTexCoord;
 }
\ No newline at end of file